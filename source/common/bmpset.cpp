@@ -22,28 +22,34 @@
 #include "bmpset.h"
 #include "uassert.h"
 
+/*
+ * spanASCII() compares 16 bytes or 8 UTF-16 code units at a time
+ * against the ASCII ranges of the set, with SSE2 which is part of the
+ * x86-64 baseline. Other platforms use only the per-code unit loops.
+ */
+#ifndef U_BMPSET_USE_SSE2
+#   if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+#       define U_BMPSET_USE_SSE2 1
+#   else
+#       define U_BMPSET_USE_SSE2 0
+#   endif
+#endif
+
+#if U_BMPSET_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 U_NAMESPACE_BEGIN
 
 BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
         list(parentList), listLength(parentListLength) {
     uprv_memset(asciiBytes, 0, sizeof(asciiBytes));
+    uprv_memset(asciiRanges, 0, sizeof(asciiRanges));
     uprv_memset(table7FF, 0, sizeof(table7FF));
     uprv_memset(bmpBlockBits, 0, sizeof(bmpBlockBits));
 
-    /*
-     * Set the list indexes for binary searches for
-     * U+0800, U+1000, U+2000, .., U+F000, U+10000.
-     * U+0800 is the first 3-byte-UTF-8 code point. Lower code points are
-     * looked up in the bit tables.
-     * The last pair of indexes is for finding supplementary code points.
-     */
-    list4kStarts[0]=findCodePoint(0x800, 0, listLength-1);
-    int32_t i;
-    for(i=1; i<=0x10; ++i) {
-        list4kStarts[i]=findCodePoint(i<<12, list4kStarts[i-1], listLength-1);
-    }
-    list4kStarts[0x11]=listLength-1;
-
+    initListStarts();
     initBits();
     overrideIllegal();
 }
@@ -51,14 +57,62 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
 BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength) :
         list(newParentList), listLength(newParentListLength) {
     uprv_memcpy(asciiBytes, otherBMPSet.asciiBytes, sizeof(asciiBytes));
+    uprv_memcpy(asciiRanges, otherBMPSet.asciiRanges, sizeof(asciiRanges));
+    asciiRangesCount=otherBMPSet.asciiRangesCount;
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
 }
 
+BMPSet::BMPSet(const uint8_t *tables, const int32_t *parentList, int32_t parentListLength) :
+        list(parentList), listLength(parentListLength) {
+    uprv_memcpy(asciiBytes, tables, sizeof(asciiBytes));
+    tables+=sizeof(asciiBytes);
+    uprv_memcpy(asciiRanges, tables, sizeof(asciiRanges));
+    tables+=sizeof(asciiRanges);
+    uprv_memcpy(&asciiRangesCount, tables, sizeof(asciiRangesCount));
+    tables+=sizeof(asciiRangesCount);
+    if(asciiRangesCount>4) {
+        asciiRangesCount=-1;  // Do not trust out-of-range data.
+    }
+    uprv_memcpy(table7FF, tables, sizeof(table7FF));
+    tables+=sizeof(table7FF);
+    uprv_memcpy(bmpBlockBits, tables, sizeof(bmpBlockBits));
+
+    initListStarts();
+}
+
 BMPSet::~BMPSet() {
 }
 
+void BMPSet::writeTables(uint8_t *dest) const {
+    uprv_memcpy(dest, asciiBytes, sizeof(asciiBytes));
+    dest+=sizeof(asciiBytes);
+    uprv_memcpy(dest, asciiRanges, sizeof(asciiRanges));
+    dest+=sizeof(asciiRanges);
+    uprv_memcpy(dest, &asciiRangesCount, sizeof(asciiRangesCount));
+    dest+=sizeof(asciiRangesCount);
+    uprv_memcpy(dest, table7FF, sizeof(table7FF));
+    dest+=sizeof(table7FF);
+    uprv_memcpy(dest, bmpBlockBits, sizeof(bmpBlockBits));
+}
+
+/*
+ * Set the list indexes for binary searches for
+ * U+0800, U+1000, U+2000, .., U+F000, U+10000.
+ * U+0800 is the first 3-byte-UTF-8 code point. Lower code points are
+ * looked up in the bit tables.
+ * The last pair of indexes is for finding supplementary code points.
+ */
+void BMPSet::initListStarts() {
+    list4kStarts[0]=findCodePoint(0x800, 0, listLength-1);
+    int32_t i;
+    for(i=1; i<=0x10; ++i) {
+        list4kStarts[i]=findCodePoint(i<<12, list4kStarts[i-1], listLength-1);
+    }
+    list4kStarts[0x11]=listLength-1;
+}
+
 /*
  * Set bits in a bit rectangle in "vertical" bit organization.
  * start<limit<=0x800
@@ -118,7 +172,8 @@ void BMPSet::initBits() {
     UChar32 start, limit;
     int32_t listIndex=0;
 
-    // Set asciiBytes[].
+    // Set asciiBytes[] and asciiRanges[].
+    asciiRangesCount=0;
     do {
         start=list[listIndex++];
         if(listIndex<listLength) {
@@ -129,6 +184,13 @@ void BMPSet::initBits() {
         if(start>=0x80) {
             break;
         }
+        if(0<=asciiRangesCount && asciiRangesCount<4) {
+            asciiRanges[2*asciiRangesCount]=(uint8_t)start;
+            asciiRanges[2*asciiRangesCount+1]=(uint8_t)(limit<=0x80 ? limit-1 : 0x7f);
+            ++asciiRangesCount;
+        } else {
+            asciiRangesCount=-1;
+        }
         do {
             asciiBytes[start++]=1;
         } while(start<limit && start<0x80);
@@ -300,6 +362,96 @@ BMPSet::contains(UChar32 c) const {
     }
 }
 
+/*
+ * Skip a prefix of ASCII code units that all match the spanCondition,
+ * 8 UTF-16 units or 16 UTF-8 bytes at a time.
+ * Returns s unchanged if the set's ASCII part has too many ranges
+ * or without SSE2; the caller continues with its normal loop.
+ */
+const UChar *
+BMPSet::spanASCII(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+#if U_BMPSET_USE_SSE2
+    if(asciiRangesCount<0) {
+        return s;
+    }
+    // Signed comparisons: lo[i]<c<=hi[i].
+    // Unused ranges are empty, and code units >=0x8000 are negative.
+    __m128i lo[4], hi[4];
+    int32_t i;
+    for(i=0; i<4; ++i) {
+        if(i<asciiRangesCount) {
+            lo[i]=_mm_set1_epi16((int16_t)(asciiRanges[2*i]-1));
+            hi[i]=_mm_set1_epi16((int16_t)asciiRanges[2*i+1]);
+        } else {
+            lo[i]=hi[i]=_mm_set1_epi16(0x7f);
+        }
+    }
+    const __m128i minusOne=_mm_set1_epi16(-1);
+    const __m128i x80=_mm_set1_epi16(0x80);
+    while((limit-s)>=8) {
+        __m128i v=_mm_loadu_si128((const __m128i *)s);
+        __m128i in=_mm_andnot_si128(_mm_cmpgt_epi16(v, hi[0]), _mm_cmpgt_epi16(v, lo[0]));
+        for(i=1; i<4; ++i) {
+            in=_mm_or_si128(in, _mm_andnot_si128(_mm_cmpgt_epi16(v, hi[i]), _mm_cmpgt_epi16(v, lo[i])));
+        }
+        if(!spanCondition) {
+            // ASCII but not in the set.
+            __m128i ascii=_mm_and_si128(_mm_cmpgt_epi16(v, minusOne), _mm_cmplt_epi16(v, x80));
+            in=_mm_andnot_si128(in, ascii);
+        }
+        if(_mm_movemask_epi8(in)!=0xffff) {
+            break;
+        }
+        s+=8;
+    }
+#else
+    (void)limit;
+    (void)spanCondition;
+#endif
+    return s;
+}
+
+const uint8_t *
+BMPSet::spanASCII(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const {
+#if U_BMPSET_USE_SSE2
+    if(asciiRangesCount<0) {
+        return s;
+    }
+    // Signed comparisons: lo[i]<b<=hi[i].
+    // Unused ranges are empty, and non-ASCII bytes are negative.
+    __m128i lo[4], hi[4];
+    int32_t i;
+    for(i=0; i<4; ++i) {
+        if(i<asciiRangesCount) {
+            lo[i]=_mm_set1_epi8((char)(asciiRanges[2*i]-1));
+            hi[i]=_mm_set1_epi8((char)asciiRanges[2*i+1]);
+        } else {
+            lo[i]=hi[i]=_mm_set1_epi8(0x7f);
+        }
+    }
+    const __m128i minusOne=_mm_set1_epi8(-1);
+    while((limit-s)>=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)s);
+        __m128i in=_mm_andnot_si128(_mm_cmpgt_epi8(v, hi[0]), _mm_cmpgt_epi8(v, lo[0]));
+        for(i=1; i<4; ++i) {
+            in=_mm_or_si128(in, _mm_andnot_si128(_mm_cmpgt_epi8(v, hi[i]), _mm_cmpgt_epi8(v, lo[i])));
+        }
+        if(!spanCondition) {
+            // ASCII but not in the set.
+            in=_mm_andnot_si128(in, _mm_cmpgt_epi8(v, minusOne));
+        }
+        if(_mm_movemask_epi8(in)!=0xffff) {
+            break;
+        }
+        s+=16;
+    }
+#else
+    (void)limit;
+    (void)spanCondition;
+#endif
+    return s;
+}
+
 /*
  * Check for sufficient length for trail unit for each surrogate pair.
  * Handle single surrogates as surrogate code points as usual in ICU.
@@ -308,6 +460,13 @@ const UChar *
 BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
     UChar c, c2;
 
+    if((limit-s)>=8) {
+        s=spanASCII(s, limit, spanCondition);
+        if(s==limit) {
+            return s;
+        }
+    }
+
     if(spanCondition) {
         // span
         do {
@@ -497,20 +656,27 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     uint8_t b=*s;
     if((int8_t)b>=0) {
         // Initial all-ASCII span.
+        if(length>=16) {
+            s=spanASCII(s, limit, spanCondition);
+            if(s==limit) {
+                return s;
+            }
+            b=*s;
+        }
         if(spanCondition) {
-            do {
+            while((int8_t)b>=0) {
                 if(!asciiBytes[b] || ++s==limit) {
                     return s;
                 }
                 b=*s;
-            } while((int8_t)b>=0);
+            }
         } else {
-            do {
+            while((int8_t)b>=0) {
                 if(asciiBytes[b] || ++s==limit) {
                     return s;
                 }
                 b=*s;
-            } while((int8_t)b>=0);
+            }
         }
         length=(int32_t)(limit-s);
     }
@@ -36,8 +36,25 @@ class BMPSet : public UMemory {
 public:
     BMPSet(const int32_t *parentList, int32_t parentListLength);
     BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength);
+    /*
+     * Constructs a BMPSet from kTablesSize bytes written by writeTables(),
+     * without looking at the parent list except for the list4kStarts[] binary searches.
+     */
+    BMPSet(const uint8_t *tables, const int32_t *parentList, int32_t parentListLength);
     virtual ~BMPSet();
 
+    /*
+     * Size of the precomputed tables image written by writeTables().
+     * The image is native-endian.
+     */
+    static const int32_t kTablesSize=0xc0+8+4+2*64*4;
+
+    /*
+     * Writes the precomputed lookup tables (all but list4kStarts[])
+     * to dest which must have kTablesSize bytes.
+     */
+    void writeTables(uint8_t *dest) const;
+
     virtual UBool contains(UChar32 c) const;
 
     /*
@@ -69,6 +86,7 @@ public:
     int32_t spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
 
 private:
+    void initListStarts();
     void initBits();
     void overrideIllegal();
 
@@ -93,6 +111,16 @@ private:
 
     inline UBool containsSlow(UChar32 c, int32_t lo, int32_t hi) const;
 
+    /*
+     * Span many ASCII code units at a time while each has
+     * spanCondition==contains(c), using asciiRanges[].
+     * Stops before the last block that cannot be spanned entirely;
+     * the caller continues one code unit at a time from there.
+     * Returns s unchanged if there is no vector implementation.
+     */
+    const UChar *spanASCII(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const;
+    const uint8_t *spanASCII(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const;
+
     /*
      * One byte per ASCII character, or trail byte in lead position.
      * 0 or 1 for ASCII characters.
@@ -101,6 +129,14 @@ private:
      */
     UBool asciiBytes[0xc0];
 
+    /*
+     * The set's ASCII code points as up to four inclusive ranges
+     * asciiRanges[2*i]..asciiRanges[2*i+1], for spanASCII().
+     * asciiRangesCount is -1 if there are more ASCII ranges.
+     */
+    uint8_t asciiRanges[8];
+    int32_t asciiRangesCount;
+
     /*
      * One bit per code point from U+0000..U+07FF.
      * The bits are organized vertically; consecutive code points
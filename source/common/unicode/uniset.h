@@ -298,7 +298,8 @@ class U_COMMON_API UnicodeSet U_FINAL : public UnicodeFilter {
 
 private:
     enum { // constants
-        kIsBogus = 1       // This set is bogus (i.e. not valid)
+        kIsBogus = 1,      // This set is bogus (i.e. not valid)
+        kIsListAlias = 2   // list aliases serialized data and is not owned
     };
     uint8_t fFlags;         // Bit flag (see constants above)
 public:
@@ -1442,6 +1443,48 @@ public:
      */
     int32_t serialize(uint16_t *dest, int32_t destCapacity, UErrorCode& ec) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Serializes this set together with the lookup tables that freeze()
+     * builds for it, so that a ready-to-use frozen set can be loaded
+     * from a data file or memory-mapped file with createFrozenFromSerialized()
+     * without parsing a pattern, loading property data or rebuilding tables.
+     * If this set is not frozen, then a frozen copy is serialized.
+     *
+     * The format is native-endian and not portable across machines
+     * with different endianness or charset family.
+     *
+     * @param dest pointer to 32-bit-aligned memory to be filled with the
+     *             serialized form; can be NULL if destCapacity==0
+     * @param destCapacity the capacity of dest in bytes
+     * @param ec error code. Will be set to U_BUFFER_OVERFLOW_ERROR if
+     *           destCapacity is too small, and to U_ILLEGAL_ARGUMENT_ERROR
+     *           if this set is bogus.
+     * @return the number of bytes required for the serialized form
+     *         (even if the call fails with U_BUFFER_OVERFLOW_ERROR)
+     * @see createFrozenFromSerialized
+     * @draft ICU 57
+     */
+    int32_t serializeFrozen(void *dest, int32_t destCapacity, UErrorCode &ec) const;
+
+    /**
+     * Creates a frozen set from the output of serializeFrozen().
+     * The inversion list is aliased, not copied, and the frozen lookup tables
+     * are used as is; the data must remain valid and unchanged for the
+     * lifetime of the set. Clones of the set do not alias the data.
+     *
+     * @param data pointer to the serialized form; must be 32-bit-aligned
+     * @param length the number of bytes available at data
+     *               (can be equal to or larger than the actual data length)
+     * @param ec error code
+     * @return a new frozen set which the caller must delete,
+     *         or NULL if an error occurred
+     * @see serializeFrozen
+     * @draft ICU 57
+     */
+    static UnicodeSet *createFrozenFromSerialized(const void *data, int32_t length, UErrorCode &ec);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Reallocate this objects internal structures to take up the least
      * possible space, without changing this object's value.
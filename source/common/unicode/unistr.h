@@ -1834,6 +1834,22 @@ public:
    */
   inline int32_t hashCode(void) const;
 
+#ifndef U_HIDE_DRAFT_API
+  /**
+   * Generate a hash code for the case-folded version of this string,
+   * without creating a folded copy.
+   * Strings that compare equal with caseCompare() and the same options
+   * have the same case-folded hash code.
+   * It is not the same as foldCase(options).hashCode().
+   *
+   * @param options Either U_FOLD_CASE_DEFAULT or U_FOLD_CASE_EXCLUDE_SPECIAL_I.
+   * @return The case-folded hash code of this UnicodeString.
+   * @see u_strFoldCaseHash
+   * @draft ICU 57
+   */
+  int32_t caseFoldedHashCode(uint32_t options=0 /*U_FOLD_CASE_DEFAULT*/) const;
+#endif  /* U_HIDE_DRAFT_API */
+
   /**
    * Determine if this object contains a valid string.
    * A bogus string has no value. It is different from an empty string,
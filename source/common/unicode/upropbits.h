@@ -0,0 +1,213 @@
+/*
+*******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+*******************************************************************************
+*   file name:  upropbits.h
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016jan18
+*
+*   Precompiled lookup of a chosen set of binary and enumerated properties.
+*/
+
+#ifndef __UPROPBITS_H__
+#define __UPROPBITS_H__
+
+#include "unicode/utypes.h"
+#include "unicode/uchar.h"
+#include "unicode/localpointer.h"
+
+/**
+ * \file
+ * \brief C API: Precompiled lookup of a chosen set of binary and enumerated properties.
+ *
+ * A UPropertyBits object is built for a list of binary and enumerated properties.
+ * It maps each code point to a 32-bit value with one bit field per property,
+ * in list order starting at bit 0.
+ * Each field is just wide enough for the property's u_getIntPropertyMaxValue():
+ * One bit for a binary property, five bits for UCHAR_GENERAL_CATEGORY
+ * (whose values are those of u_charType()), etc.
+ * The fields of all properties must fit into 32 bits.
+ * With only binary properties, bit i is set if and only if
+ * the code point has the i-th property.
+ * upbits_getValue() extracts one property's value.
+ *
+ * All properties are looked up with a single trie probe per code point,
+ * instead of one u_hasBinaryProperty() or u_getIntPropertyValue() call
+ * (and possibly several lookups in different data structures) per property.
+ *
+ * u_getPropertyBitsBulk() classifies a whole string into a caller array,
+ * for example for tokenizers.
+ *
+ * Building the object enumerates the properties' code point ranges.
+ * This can be done once at build time: Serialize the object
+ * with upbits_serialize() and open it with upbits_openFromSerialized()
+ * which does not copy nor build anything.
+ *
+ * A UPropertyBits object is immutable and can be used concurrently
+ * from multiple threads.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Opaque property bits lookup object.
+ * @draft ICU 57
+ */
+struct UPropertyBits;
+/** @draft ICU 57 */
+typedef struct UPropertyBits UPropertyBits;
+
+/**
+ * Open a property bits lookup object for a list of binary and enumerated properties.
+ * The bit field for properties[i] follows the fields of properties[0..i-1].
+ *
+ * @param properties an array of binary properties (UCHAR_BINARY_START..UCHAR_BINARY_LIMIT-1)
+ *                   and enumerated properties (UCHAR_INT_START..UCHAR_INT_LIMIT-1)
+ * @param count the number of properties, 1..32
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ *                   Set to U_ILLEGAL_ARGUMENT_ERROR if a property is neither binary
+ *                   nor enumerated, if count is out of range,
+ *                   or if the bit fields do not fit into 32 bits.
+ * @return the new object, or NULL if an error occurred
+ * @draft ICU 57
+ */
+U_DRAFT UPropertyBits * U_EXPORT2
+upbits_open(const UProperty *properties, int32_t count, UErrorCode *pErrorCode);
+
+/**
+ * Open a property bits lookup object from its serialized form.
+ * The buffer is aliased, not copied; it must remain valid and unchanged
+ * for the lifetime of the object.
+ * The serialized form is not portable across machines with
+ * different endianness or charset family.
+ *
+ * @param buffer pointer to the serialized form; must be 32-bit-aligned
+ * @param length the capacity of this buffer (can be equal to or larger than
+ *               the actual data length)
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the new object, or NULL if an error occurred
+ * @see upbits_serialize
+ * @draft ICU 57
+ */
+U_DRAFT UPropertyBits * U_EXPORT2
+upbits_openFromSerialized(const void *buffer, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Close a property bits lookup object.
+ * @param pbits the object to close; can be NULL
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+upbits_close(UPropertyBits *pbits);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUPropertyBitsPointer
+ * "Smart pointer" class, closes a UPropertyBits via upbits_close().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 57
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUPropertyBitsPointer, UPropertyBits, upbits_close);
+
+U_NAMESPACE_END
+
+#endif
+
+/**
+ * Serialize a property bits lookup object into a linear buffer.
+ *
+ * @param pbits the object to serialize
+ * @param buffer pointer to 32-bit-aligned memory to be filled with the
+ *               serialized form; can be NULL if bufferCapacity==0
+ * @param bufferCapacity the capacity of this buffer in bytes
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the required buffer capacity to hold the serialized data (even if the call fails
+ *         with a U_BUFFER_OVERFLOW_ERROR, it will return the required capacity)
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+upbits_serialize(const UPropertyBits *pbits,
+                 void *buffer, int32_t bufferCapacity, UErrorCode *pErrorCode);
+
+/**
+ * Get the number of properties in this object.
+ * @param pbits the object
+ * @return the number of properties (bit fields)
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+upbits_countProperties(const UPropertyBits *pbits);
+
+/**
+ * Get the property for bit field i.
+ * @param pbits the object
+ * @param i property index, 0..upbits_countProperties()-1
+ * @return the property, or UCHAR_INVALID_CODE if i is out of range
+ * @draft ICU 57
+ */
+U_DRAFT UProperty U_EXPORT2
+upbits_getProperty(const UPropertyBits *pbits, int32_t i);
+
+/**
+ * Get the property bits for a code point.
+ * @param pbits the object
+ * @param c the code point
+ * @return the property bits for c; 0 for values outside 0..U+10FFFF
+ * @draft ICU 57
+ */
+U_DRAFT uint32_t U_EXPORT2
+upbits_get(const UPropertyBits *pbits, UChar32 c);
+
+/**
+ * Extract the value of property i from property bits.
+ * @param pbits the object
+ * @param bits property bits from upbits_get() or u_getPropertyBitsBulk()
+ * @param i property index, 0..upbits_countProperties()-1
+ * @return the property value, as from u_getIntPropertyValue();
+ *         0 if i is out of range
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+upbits_getValue(const UPropertyBits *pbits, uint32_t bits, int32_t i);
+
+/**
+ * Classify a UTF-16 string: Write the property bits for each code unit.
+ * Both units of a surrogate pair get the bits of the supplementary code point.
+ * An unpaired surrogate gets the bits of the surrogate code point.
+ *
+ * @param pbits the object
+ * @param s the UTF-16 string
+ * @param length the length of the string, or -1 if NUL-terminated
+ * @param dest the destination array
+ * @param destCapacity the number of uint32_t values available at dest
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ *                   Set to U_BUFFER_OVERFLOW_ERROR if destCapacity is smaller than the string length;
+ *                   nothing is written in that case.
+ * @return the string length
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_getPropertyBitsBulk(const UPropertyBits *pbits,
+                      const UChar *s, int32_t length,
+                      uint32_t *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode);
+
+#endif  /* U_HIDE_DRAFT_API */
+
+#endif  /* __UPROPBITS_H__ */
@@ -268,6 +268,7 @@
 #define u_getIntPropertyValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValue)
 #define u_getMainProperties U_ICU_ENTRY_POINT_RENAME(u_getMainProperties)
 #define u_getNumericValue U_ICU_ENTRY_POINT_RENAME(u_getNumericValue)
+#define u_getPropertyBitsBulk U_ICU_ENTRY_POINT_RENAME(u_getPropertyBitsBulk)
 #define u_getPropertyEnum U_ICU_ENTRY_POINT_RENAME(u_getPropertyEnum)
 #define u_getPropertyName U_ICU_ENTRY_POINT_RENAME(u_getPropertyName)
 #define u_getPropertyValueEnum U_ICU_ENTRY_POINT_RENAME(u_getPropertyValueEnum)
@@ -348,6 +349,7 @@
 #define u_strFindFirst U_ICU_ENTRY_POINT_RENAME(u_strFindFirst)
 #define u_strFindLast U_ICU_ENTRY_POINT_RENAME(u_strFindLast)
 #define u_strFoldCase U_ICU_ENTRY_POINT_RENAME(u_strFoldCase)
+#define u_strFoldCaseHash U_ICU_ENTRY_POINT_RENAME(u_strFoldCaseHash)
 #define u_strFromJavaModifiedUTF8WithSub U_ICU_ENTRY_POINT_RENAME(u_strFromJavaModifiedUTF8WithSub)
 #define u_strFromPunycode U_ICU_ENTRY_POINT_RENAME(u_strFromPunycode)
 #define u_strFromUTF32 U_ICU_ENTRY_POINT_RENAME(u_strFromUTF32)
@@ -724,6 +726,7 @@
 #define ucol_getSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getSortKey)
 #define ucol_getStrength U_ICU_ENTRY_POINT_RENAME(ucol_getStrength)
 #define ucol_getTailoredSet U_ICU_ENTRY_POINT_RENAME(ucol_getTailoredSet)
+#define ucol_getTruncatedSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getTruncatedSortKey)
 #define ucol_getUCAVersion U_ICU_ENTRY_POINT_RENAME(ucol_getUCAVersion)
 #define ucol_getUnsafeSet U_ICU_ENTRY_POINT_RENAME(ucol_getUnsafeSet)
 #define ucol_getVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_getVariableTop)
@@ -756,6 +759,7 @@
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
@@ -1142,8 +1146,10 @@
 #define unum_format U_ICU_ENTRY_POINT_RENAME(unum_format)
 #define unum_formatDecimal U_ICU_ENTRY_POINT_RENAME(unum_formatDecimal)
 #define unum_formatDouble U_ICU_ENTRY_POINT_RENAME(unum_formatDouble)
+#define unum_formatDoubleArray U_ICU_ENTRY_POINT_RENAME(unum_formatDoubleArray)
 #define unum_formatDoubleCurrency U_ICU_ENTRY_POINT_RENAME(unum_formatDoubleCurrency)
 #define unum_formatInt64 U_ICU_ENTRY_POINT_RENAME(unum_formatInt64)
+#define unum_formatInt64Array U_ICU_ENTRY_POINT_RENAME(unum_formatInt64Array)
 #define unum_formatUFormattable U_ICU_ENTRY_POINT_RENAME(unum_formatUFormattable)
 #define unum_getAttribute U_ICU_ENTRY_POINT_RENAME(unum_getAttribute)
 #define unum_getAvailable U_ICU_ENTRY_POINT_RENAME(unum_getAvailable)
@@ -1173,6 +1179,14 @@
 #define unumsys_open U_ICU_ENTRY_POINT_RENAME(unumsys_open)
 #define unumsys_openAvailableNames U_ICU_ENTRY_POINT_RENAME(unumsys_openAvailableNames)
 #define unumsys_openByName U_ICU_ENTRY_POINT_RENAME(unumsys_openByName)
+#define upbits_close U_ICU_ENTRY_POINT_RENAME(upbits_close)
+#define upbits_countProperties U_ICU_ENTRY_POINT_RENAME(upbits_countProperties)
+#define upbits_get U_ICU_ENTRY_POINT_RENAME(upbits_get)
+#define upbits_getProperty U_ICU_ENTRY_POINT_RENAME(upbits_getProperty)
+#define upbits_getValue U_ICU_ENTRY_POINT_RENAME(upbits_getValue)
+#define upbits_open U_ICU_ENTRY_POINT_RENAME(upbits_open)
+#define upbits_openFromSerialized U_ICU_ENTRY_POINT_RENAME(upbits_openFromSerialized)
+#define upbits_serialize U_ICU_ENTRY_POINT_RENAME(upbits_serialize)
 #define uplrules_close U_ICU_ENTRY_POINT_RENAME(uplrules_close)
 #define uplrules_open U_ICU_ENTRY_POINT_RENAME(uplrules_open)
 #define uplrules_openForType U_ICU_ENTRY_POINT_RENAME(uplrules_openForType)
@@ -1507,6 +1521,8 @@
 #define uscript_resetRun U_ICU_ENTRY_POINT_RENAME(uscript_resetRun)
 #define uscript_setRunText U_ICU_ENTRY_POINT_RENAME(uscript_setRunText)
 #define usearch_close U_ICU_ENTRY_POINT_RENAME(usearch_close)
+#define usearch_closeMulti U_ICU_ENTRY_POINT_RENAME(usearch_closeMulti)
+#define usearch_findAllMulti U_ICU_ENTRY_POINT_RENAME(usearch_findAllMulti)
 #define usearch_first U_ICU_ENTRY_POINT_RENAME(usearch_first)
 #define usearch_following U_ICU_ENTRY_POINT_RENAME(usearch_following)
 #define usearch_getAttribute U_ICU_ENTRY_POINT_RENAME(usearch_getAttribute)
@@ -1526,6 +1542,7 @@
 #define usearch_next U_ICU_ENTRY_POINT_RENAME(usearch_next)
 #define usearch_open U_ICU_ENTRY_POINT_RENAME(usearch_open)
 #define usearch_openFromCollator U_ICU_ENTRY_POINT_RENAME(usearch_openFromCollator)
+#define usearch_openMulti U_ICU_ENTRY_POINT_RENAME(usearch_openMulti)
 #define usearch_preceding U_ICU_ENTRY_POINT_RENAME(usearch_preceding)
 #define usearch_previous U_ICU_ENTRY_POINT_RENAME(usearch_previous)
 #define usearch_reset U_ICU_ENTRY_POINT_RENAME(usearch_reset)
@@ -654,6 +654,29 @@ u_strncasecmp(const UChar *s1, const UChar *s2, int32_t n, uint32_t options);
 U_STABLE int32_t U_EXPORT2
 u_memcasecmp(const UChar *s1, const UChar *s2, int32_t length, uint32_t options);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Compute a hash code for a string as if it had been case-folded,
+ * without writing the folded string anywhere.
+ * Strings for which u_strCaseCompare() returns 0 with the same
+ * case folding options have the same hash code,
+ * which makes this suitable for case-insensitive hash tables.
+ *
+ * The hash code is not the same as that of the case-folded string
+ * via UnicodeString::hashCode().
+ *
+ * @param s The source string.
+ * @param length The length of the source string, or -1 if NUL-terminated.
+ * @param options Either U_FOLD_CASE_DEFAULT or U_FOLD_CASE_EXCLUDE_SPECIAL_I.
+ *                Other option bits, like U_COMPARE_CODE_POINT_ORDER, are ignored.
+ * @return The hash code; 0 if s is NULL or length<-1.
+ * @see u_strCaseCompare
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strFoldCaseHash(const UChar *s, int32_t length, uint32_t options);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Copy a ustring. Adds a null terminator.
  *
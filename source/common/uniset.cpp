@@ -24,6 +24,7 @@
 #include "charstr.h"
 #include "ustrfmt.h"
 #include "uassert.h"
+#include "ucmndata.h"
 #include "bmpset.h"
 #include "unisetspan.h"
 
@@ -256,7 +257,9 @@ UnicodeSet::UnicodeSet(const UnicodeSet& o, UBool /* asThawed */) :
  */
 UnicodeSet::~UnicodeSet() {
     _dbgdt(this); // first!
-    uprv_free(list);
+    if ((fFlags & kIsListAlias) == 0) {
+        uprv_free(list);
+    }
     delete bmpSet;
     if (buffer) {
         uprv_free(buffer);
@@ -1626,6 +1629,249 @@ int32_t UnicodeSet::serialize(uint16_t *dest, int32_t destCapacity, UErrorCode&
     return destLength;
 }
 
+static const UDataInfo frozenDataInfo={
+    sizeof(UDataInfo),
+    0,
+
+    U_IS_BIG_ENDIAN,
+    U_CHARSET_FAMILY,
+    U_SIZEOF_UCHAR,
+    0,
+
+    { 0x46, 0x53, 0x65, 0x74 },   /* dataFormat="FSet" */
+    { 1, 0, 0, 0 },               /* formatVersion */
+    { 0, 0, 0, 0 }                /* dataVersion */
+};
+
+enum {
+    FSET_INDEX_LIST_LENGTH,         // number of inversion list values, including the terminator
+    FSET_INDEX_BMPSET_SIZE,         // BMPSet tables size in bytes, or 0 if there is no BMPSet
+    FSET_INDEX_STRINGS_COUNT,       // number of strings
+    FSET_INDEX_STRINGS_LENGTH,      // number of UChars for the strings, including length units
+    FSET_INDEX_SIZE=7,              // bytes following the DataHeader
+    FSET_INDEX_COUNT=8
+};
+
+/*
+ * Serialized form of a frozen UnicodeSet, formatVersion 1:
+ *
+ * The serialized form begins with a standard ICU DataHeader with a UDataInfo
+ * as the template above.
+ * This is followed by:
+ *   int32_t indexes[FSET_INDEX_COUNT];     // see index entry constants above
+ *   UChar32 list[indexes[FSET_INDEX_LIST_LENGTH]];  // inversion list, terminated with 0x110000
+ *   uint8_t bmpSetTables[indexes[FSET_INDEX_BMPSET_SIZE]];  // see BMPSet::writeTables()
+ *   UChar strings[indexes[FSET_INDEX_STRINGS_LENGTH]];
+ *   padding to a multiple of 4 bytes
+ *
+ * Each string is stored as one length unit followed by its UChars,
+ * in the order of the set's strings vector.
+ * There are BMPSet tables if and only if the frozen set has a BMPSet,
+ * that is, if it has no strings that are relevant for span().
+ * Otherwise, the UnicodeSetStringSpan is rebuilt when the set is loaded.
+ *
+ * There is no swapper: The data must be used on a machine with
+ * the same endianness and charset family as where it was serialized.
+ */
+
+int32_t UnicodeSet::serializeFrozen(void *dest, int32_t destCapacity, UErrorCode &ec) const {
+    if (U_FAILURE(ec)) {
+        return 0;
+    }
+    uint8_t *p = (uint8_t *)dest;
+    if (isBogus() || destCapacity < 0 ||
+            (destCapacity > 0 && (p == NULL || U_POINTER_MASK_LSB(p, 3) != 0))) {
+        ec = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (!isFrozen()) {
+        UnicodeSet frozen(*this);
+        frozen.freeze();
+        if (frozen.isBogus()) {
+            ec = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        return frozen.serializeFrozen(dest, destCapacity, ec);
+    }
+
+    int32_t indexes[FSET_INDEX_COUNT] = {
+        len,
+        bmpSet != NULL ? BMPSet::kTablesSize : 0,
+        strings->size()
+    };
+    int32_t stringsLength = 0;
+    for (int32_t i = 0; i < strings->size(); ++i) {
+        const UnicodeString &str = *(const UnicodeString *)strings->elementAt(i);
+        if (str.length() > 0xffff) {
+            ec = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        stringsLength += 1 + str.length();
+    }
+    indexes[FSET_INDEX_STRINGS_LENGTH] = stringsLength;
+
+    DataHeader header;
+    uprv_memset(&header, 0, sizeof(header));
+    header.dataHeader.headerSize = (uint16_t)((sizeof(header) + 15) & ~15);
+    header.dataHeader.magic1 = 0xda;
+    header.dataHeader.magic2 = 0x27;
+    uprv_memcpy(&header.info, &frozenDataInfo, sizeof(frozenDataInfo));
+
+    int32_t headerSize = header.dataHeader.headerSize;
+    int32_t size =
+        (int32_t)sizeof(indexes) +
+        len * 4 +
+        indexes[FSET_INDEX_BMPSET_SIZE] +
+        ((stringsLength * U_SIZEOF_UCHAR + 3) & ~3);
+    indexes[FSET_INDEX_SIZE] = size;
+    if ((headerSize + size) > destCapacity) {
+        ec = U_BUFFER_OVERFLOW_ERROR;
+        return headerSize + size;
+    }
+
+    uprv_memcpy(p, &header, sizeof(header));
+    uprv_memset(p + sizeof(header), 0, headerSize - sizeof(header));
+    p += headerSize;
+    uprv_memcpy(p, indexes, sizeof(indexes));
+    p += sizeof(indexes);
+    uprv_memcpy(p, list, len * 4);
+    p += len * 4;
+    if (bmpSet != NULL) {
+        bmpSet->writeTables(p);
+        p += BMPSet::kTablesSize;
+    }
+    UChar *u = (UChar *)p;
+    for (int32_t i = 0; i < strings->size(); ++i) {
+        const UnicodeString &str = *(const UnicodeString *)strings->elementAt(i);
+        *u++ = (UChar)str.length();
+        str.extract(0, str.length(), u);
+        u += str.length();
+    }
+    if (stringsLength & 1) {
+        *u = 0;
+    }
+    return headerSize + size;
+}
+
+UnicodeSet *UnicodeSet::createFrozenFromSerialized(const void *data, int32_t length, UErrorCode &ec) {
+    if (U_FAILURE(ec)) {
+        return NULL;
+    }
+    const uint8_t *p = (const uint8_t *)data;
+    if (length <= 0 || p == NULL || U_POINTER_MASK_LSB(p, 3) != 0) {
+        ec = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    if (length < 32) {
+        // not even enough space for a minimal header
+        ec = U_INDEX_OUTOFBOUNDS_ERROR;
+        return NULL;
+    }
+    const DataHeader *pHeader = (const DataHeader *)p;
+    const UDataInfo *pInfo = &pHeader->info;
+    if (!(
+        pHeader->dataHeader.magic1 == 0xda &&
+        pHeader->dataHeader.magic2 == 0x27 &&
+        pInfo->isBigEndian == U_IS_BIG_ENDIAN &&
+        pInfo->charsetFamily == U_CHARSET_FAMILY &&
+        pInfo->dataFormat[0] == 0x46 &&
+        pInfo->dataFormat[1] == 0x53 &&
+        pInfo->dataFormat[2] == 0x65 &&
+        pInfo->dataFormat[3] == 0x74
+    )) {
+        ec = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    if (pInfo->formatVersion[0] != 1) {
+        ec = U_UNSUPPORTED_ERROR;
+        return NULL;
+    }
+    int32_t headerSize = pHeader->dataHeader.headerSize;
+    if (length < (headerSize + (int32_t)sizeof(int32_t) * FSET_INDEX_COUNT)) {
+        ec = U_INDEX_OUTOFBOUNDS_ERROR;
+        return NULL;
+    }
+    p += headerSize;
+    length -= headerSize;
+    const int32_t *indexes = (const int32_t *)p;
+    if (length < indexes[FSET_INDEX_SIZE]) {
+        ec = U_INDEX_OUTOFBOUNDS_ERROR;
+        return NULL;
+    }
+    int32_t listLength = indexes[FSET_INDEX_LIST_LENGTH];
+    int32_t bmpSetSize = indexes[FSET_INDEX_BMPSET_SIZE];
+    int32_t stringsCount = indexes[FSET_INDEX_STRINGS_COUNT];
+    int32_t stringsLength = indexes[FSET_INDEX_STRINGS_LENGTH];
+    if (listLength <= 0 || listLength > (length / 4) ||
+            stringsCount < 0 || stringsLength < stringsCount || stringsLength > (length / 2) ||
+            (bmpSetSize != 0 && bmpSetSize != BMPSet::kTablesSize) ||
+            (bmpSetSize == 0 && stringsCount == 0) ||
+            indexes[FSET_INDEX_SIZE] <
+                (int32_t)sizeof(int32_t) * (FSET_INDEX_COUNT + listLength) +
+                bmpSetSize + stringsLength * U_SIZEOF_UCHAR) {
+        ec = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    p += sizeof(int32_t) * FSET_INDEX_COUNT;
+    const UChar32 *setList = (const UChar32 *)p;
+    if (setList[listLength - 1] != UNICODESET_HIGH) {
+        ec = U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    p += sizeof(int32_t) * listLength;
+    const uint8_t *bmpSetTables = p;
+    p += bmpSetSize;
+
+    LocalPointer<UnicodeSet> set(new UnicodeSet(), ec);
+    if (U_FAILURE(ec) || set->isBogus()) {
+        if (U_SUCCESS(ec)) {
+            ec = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return NULL;
+    }
+    uprv_free(set->list);
+    set->list = const_cast<UChar32 *>(setList);
+    set->len = set->capacity = listLength;
+    set->fFlags |= kIsListAlias;
+
+    // The strings are read-only aliases of the serialized data.
+    const UChar *s = (const UChar *)p;
+    const UChar *sLimit = s + stringsLength;
+    for (int32_t i = 0; i < stringsCount; ++i) {
+        int32_t sLength = *s++;
+        if (sLength > (sLimit - s)) {
+            ec = U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+        UnicodeString *str = new UnicodeString(FALSE, s, sLength);
+        if (str == NULL) {
+            ec = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        set->strings->addElement(str, ec);
+        if (U_FAILURE(ec)) {
+            delete str;
+            return NULL;
+        }
+        s += sLength;
+    }
+
+    if (bmpSetSize != 0) {
+        set->bmpSet = new BMPSet(bmpSetTables, set->list, set->len);
+        if (set->bmpSet == NULL) {
+            ec = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+    } else {
+        set->stringSpan = new UnicodeSetStringSpan(*set, *set->strings, UnicodeSetStringSpan::ALL);
+        if (set->stringSpan == NULL) {
+            ec = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+    }
+    return set.orphan();
+}
+
 //----------------------------------------------------------------
 // Implementation: Utility methods
 //----------------------------------------------------------------
@@ -1695,7 +1941,7 @@ void UnicodeSet::swapBuffers(void) {
 
 void UnicodeSet::setToBogus() {
     clear(); // Remove everything in the set.
-    fFlags = kIsBogus;
+    fFlags = (uint8_t)(kIsBogus | (fFlags & kIsListAlias));
 }
 
 //----------------------------------------------------------------
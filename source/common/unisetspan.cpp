@@ -19,6 +19,11 @@
 #include "unicode/ustring.h"
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
+#include "unicode/bytestrie.h"
+#include "unicode/bytestriebuilder.h"
+#include "unicode/ucharstrie.h"
+#include "unicode/ucharstriebuilder.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "uvector.h"
 #include "unisetspan.h"
@@ -161,6 +166,22 @@ private:
     UBool staticList[16];
 };
 
+/*
+ * Tries over the strings of a frozen set with many strings.
+ * The value for each string is its index in the strings vector.
+ * The backward tries contain the strings with their code units (bytes) reversed.
+ * The UTF-8 tries are empty if no string is representable in UTF-8.
+ */
+class UnicodeSetStringTries : public UMemory {
+public:
+    UnicodeString fwd16, back16;
+    CharString fwd8, back8;
+};
+
+// Use tries for sets with at least this many strings.
+// Comparing string by string is faster for a few strings.
+static const int32_t MIN_TRIE_STRINGS=8;
+
 // Get the number of UTF-8 bytes for a UTF-16 (sub)string.
 static int32_t
 getUTF8Length(const UChar *s, int32_t length) {
@@ -206,7 +227,7 @@ UnicodeSetStringSpan::UnicodeSetStringSpan(const UnicodeSet &set,
           utf8Lengths(NULL), spanLengths(NULL), utf8(NULL),
           utf8Length(0),
           maxLength16(0), maxLength8(0),
-          all((UBool)(which==ALL)) {
+          all((UBool)(which==ALL)), tries(NULL) {
     spanSet.retainAll(set);
     if(which&NOT_CONTAINED) {
         // Default to the same sets.
@@ -384,6 +405,9 @@ UnicodeSetStringSpan::UnicodeSetStringSpan(const UnicodeSet &set,
     // Finish.
     if(all) {
         pSpanNotSet->freeze();
+        if(stringsLength>=MIN_TRIE_STRINGS) {
+            buildTries();
+        }
     }
 }
 
@@ -394,7 +418,7 @@ UnicodeSetStringSpan::UnicodeSetStringSpan(const UnicodeSetStringSpan &otherStri
           utf8Lengths(NULL), spanLengths(NULL), utf8(NULL),
           utf8Length(otherStringSpan.utf8Length),
           maxLength16(otherStringSpan.maxLength16), maxLength8(otherStringSpan.maxLength8),
-          all(TRUE) {
+          all(TRUE), tries(NULL) {
     if(otherStringSpan.pSpanNotSet==&otherStringSpan.spanSet) {
         pSpanNotSet=&spanSet;
     } else {
@@ -418,6 +442,21 @@ UnicodeSetStringSpan::UnicodeSetStringSpan(const UnicodeSetStringSpan &otherStri
     spanLengths=(uint8_t *)(utf8Lengths+stringsLength);
     utf8=spanLengths+stringsLength*4;
     uprv_memcpy(utf8Lengths, otherStringSpan.utf8Lengths, allocSize);
+
+    if(otherStringSpan.tries!=NULL) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        tries=new UnicodeSetStringTries;
+        if(tries!=NULL) {
+            tries->fwd16=otherStringSpan.tries->fwd16;
+            tries->back16=otherStringSpan.tries->back16;
+            tries->fwd8.copyFrom(otherStringSpan.tries->fwd8, errorCode);
+            tries->back8.copyFrom(otherStringSpan.tries->back8, errorCode);
+            if(U_FAILURE(errorCode)) {
+                delete tries;  // Fall back to matching string by string.
+                tries=NULL;
+            }
+        }
+    }
 }
 
 UnicodeSetStringSpan::~UnicodeSetStringSpan() {
@@ -427,6 +466,7 @@ UnicodeSetStringSpan::~UnicodeSetStringSpan() {
     if(utf8Lengths!=NULL && utf8Lengths!=staticLengths) {
         uprv_free(utf8Lengths);
     }
+    delete tries;
 }
 
 void UnicodeSetStringSpan::addToSpanNotSet(UChar32 c) {
@@ -444,6 +484,48 @@ void UnicodeSetStringSpan::addToSpanNotSet(UChar32 c) {
     pSpanNotSet->add(c);
 }
 
+void UnicodeSetStringSpan::buildTries() {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    LocalPointer<UnicodeSetStringTries> newTries(new UnicodeSetStringTries, errorCode);
+    UCharsTrieBuilder fwd16(errorCode), back16(errorCode);
+    BytesTrieBuilder fwd8(errorCode), back8(errorCode);
+    UnicodeString reversed16;
+    CharString reversed8;
+    const uint8_t *s8=utf8;
+    int32_t i, j, stringsLength=strings.size();
+    for(i=0; i<stringsLength; ++i) {
+        const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
+        const UChar *s16=string.getBuffer();
+        int32_t length16=string.length();
+        fwd16.add(string, i, errorCode);
+        reversed16.remove();
+        for(j=length16; j>0;) {
+            reversed16.append(s16[--j]);
+        }
+        back16.add(reversed16, i, errorCode);
+
+        int32_t length8=utf8Lengths[i];
+        if(length8!=0) {
+            fwd8.add(StringPiece((const char *)s8, length8), i, errorCode);
+            reversed8.clear();
+            for(j=length8; j>0;) {
+                reversed8.append((char)s8[--j], errorCode);
+            }
+            back8.add(reversed8.toStringPiece(), i, errorCode);
+            s8+=length8;
+        }
+    }
+    fwd16.buildUnicodeString(USTRINGTRIE_BUILD_FAST, newTries->fwd16, errorCode);
+    back16.buildUnicodeString(USTRINGTRIE_BUILD_FAST, newTries->back16, errorCode);
+    if(s8!=utf8) {
+        newTries->fwd8.append(fwd8.buildStringPiece(USTRINGTRIE_BUILD_FAST, errorCode), errorCode);
+        newTries->back8.append(back8.buildStringPiece(USTRINGTRIE_BUILD_FAST, errorCode), errorCode);
+    }
+    if(U_SUCCESS(errorCode)) {
+        tries=newTries.orphan();
+    }  // else fall back to matching string by string.
+}
+
 // Compare strings without any argument checks. Requires length>0.
 static inline UBool
 matches16(const UChar *s, const UChar *t, int32_t length) {
@@ -521,6 +603,428 @@ spanOneBackUTF8(const UnicodeSet &set, const uint8_t *s, int32_t length) {
     return set.contains(c) ? length : -length;
 }
 
+/*
+ * Trie versions of the string matching loops.
+ *
+ * Rather than trying each string at each overlap position,
+ * walk the forward (backward) trie once from each possible string start (end)
+ * in the overlap range and check each string match against the same
+ * conditions as in the string-by-string loops.
+ * The work per position is proportional to the lengths of the strings
+ * but independent of their number.
+ */
+
+UBool UnicodeSetStringSpan::matchStrings(const UChar *s, int32_t length,
+                                         int32_t pos, int32_t spanLength,
+                                         OffsetList &offsets) const {
+    int32_t rest=length-pos;
+    int32_t start=pos-(spanLength<maxLength16 ? spanLength : maxLength16);
+    for(; start<=pos; ++start) {
+        if(0<start && U16_IS_LEAD(s[start-1]) && U16_IS_TRAIL(s[start])) {
+            continue;  // Not a code point boundary.
+        }
+        int32_t overlap=pos-start;
+        UCharsTrie trie(tries->fwd16.getBuffer());
+        UStringTrieResult result=trie.first(s[start]);
+        int32_t limit=start+1;
+        for(;;) {
+            if(USTRINGTRIE_HAS_VALUE(result) &&
+                    !(limit<length && U16_IS_LEAD(s[limit-1]) && U16_IS_TRAIL(s[limit]))) {
+                int32_t i=trie.getValue();
+                int32_t maxOverlap=spanLengths[i];
+                if(maxOverlap!=ALL_CP_CONTAINED) {
+                    int32_t length16=limit-start;
+                    if(maxOverlap>=LONG_SPAN) {
+                        // The matched text is the string.
+                        maxOverlap=length16;
+                        U16_BACK_1(s+start, 0, maxOverlap);
+                    }
+                    int32_t inc=length16-overlap;
+                    if(overlap<=maxOverlap && !offsets.containsOffset(inc)) {
+                        if(inc==rest) {
+                            return TRUE;  // Reached the end of the string.
+                        }
+                        offsets.addOffset(inc);
+                    }
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || limit==length) {
+                break;
+            }
+            result=trie.next(s[limit++]);
+        }
+    }
+    return FALSE;
+}
+
+void UnicodeSetStringSpan::matchLongest(const UChar *s, int32_t length,
+                                        int32_t pos, int32_t spanLength,
+                                        int32_t &maxInc, int32_t &maxOverlap) const {
+    // Try the earliest start first; stop after the first start with a match.
+    int32_t start=pos-(spanLength<maxLength16 ? spanLength : maxLength16);
+    for(; start<=pos; ++start) {
+        if(0<start && U16_IS_LEAD(s[start-1]) && U16_IS_TRAIL(s[start])) {
+            continue;  // Not a code point boundary.
+        }
+        int32_t overlap=pos-start;
+        UCharsTrie trie(tries->fwd16.getBuffer());
+        UStringTrieResult result=trie.first(s[start]);
+        int32_t limit=start+1;
+        UBool found=FALSE;
+        for(;;) {
+            if(USTRINGTRIE_HAS_VALUE(result) &&
+                    !(limit<length && U16_IS_LEAD(s[limit-1]) && U16_IS_TRAIL(s[limit]))) {
+                int32_t spanLengthByte=spanLengths[trie.getValue()];
+                int32_t inc=limit-start-overlap;
+                if(inc>=0 && (spanLengthByte>=LONG_SPAN || overlap<=spanLengthByte)) {
+                    maxInc=inc;  // Longest match from earliest start.
+                    maxOverlap=overlap;
+                    found=TRUE;
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || limit==length) {
+                break;
+            }
+            result=trie.next(s[limit++]);
+        }
+        if(found) {
+            return;
+        }
+    }
+}
+
+UBool UnicodeSetStringSpan::matchStringsBack(const UChar *s, int32_t length,
+                                             int32_t pos, int32_t spanLength,
+                                             OffsetList &offsets) const {
+    const uint8_t *spanBackLengths=spanLengths+strings.size();
+    int32_t limit=pos+(spanLength<maxLength16 ? spanLength : maxLength16);
+    for(; limit>=pos; --limit) {
+        if(limit<length && U16_IS_LEAD(s[limit-1]) && U16_IS_TRAIL(s[limit])) {
+            continue;  // Not a code point boundary.
+        }
+        int32_t overlap=limit-pos;
+        UCharsTrie trie(tries->back16.getBuffer());
+        int32_t start=limit-1;
+        UStringTrieResult result=trie.first(s[start]);
+        for(;;) {
+            if(USTRINGTRIE_HAS_VALUE(result) &&
+                    !(0<start && U16_IS_LEAD(s[start-1]) && U16_IS_TRAIL(s[start]))) {
+                int32_t i=trie.getValue();
+                int32_t maxOverlap=spanBackLengths[i];
+                if(maxOverlap!=ALL_CP_CONTAINED) {
+                    int32_t length16=limit-start;
+                    if(maxOverlap>=LONG_SPAN) {
+                        // The matched text is the string.
+                        maxOverlap=length16;
+                        int32_t len1=0;
+                        U16_FWD_1(s+start, len1, maxOverlap);
+                        maxOverlap-=len1;
+                    }
+                    int32_t dec=length16-overlap;
+                    if(overlap<=maxOverlap && !offsets.containsOffset(dec)) {
+                        if(dec==pos) {
+                            return TRUE;  // Reached the start of the string.
+                        }
+                        offsets.addOffset(dec);
+                    }
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || start==0) {
+                break;
+            }
+            result=trie.next(s[--start]);
+        }
+    }
+    return FALSE;
+}
+
+void UnicodeSetStringSpan::matchLongestBack(const UChar *s, int32_t length,
+                                            int32_t pos, int32_t spanLength,
+                                            int32_t &maxDec, int32_t &maxOverlap) const {
+    // Try the latest end first; stop after the first end with a match.
+    const uint8_t *spanBackLengths=spanLengths+strings.size();
+    int32_t limit=pos+(spanLength<maxLength16 ? spanLength : maxLength16);
+    for(; limit>=pos; --limit) {
+        if(limit<length && U16_IS_LEAD(s[limit-1]) && U16_IS_TRAIL(s[limit])) {
+            continue;  // Not a code point boundary.
+        }
+        int32_t overlap=limit-pos;
+        UCharsTrie trie(tries->back16.getBuffer());
+        int32_t start=limit-1;
+        UStringTrieResult result=trie.first(s[start]);
+        UBool found=FALSE;
+        for(;;) {
+            if(USTRINGTRIE_HAS_VALUE(result) &&
+                    !(0<start && U16_IS_LEAD(s[start-1]) && U16_IS_TRAIL(s[start]))) {
+                int32_t spanLengthByte=spanBackLengths[trie.getValue()];
+                int32_t dec=limit-start-overlap;
+                if(dec>=0 && (spanLengthByte>=LONG_SPAN || overlap<=spanLengthByte)) {
+                    maxDec=dec;  // Longest match from latest end.
+                    maxOverlap=overlap;
+                    found=TRUE;
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || start==0) {
+                break;
+            }
+            result=trie.next(s[--start]);
+        }
+        if(found) {
+            return;
+        }
+    }
+}
+
+UBool UnicodeSetStringSpan::matchStringsUTF8(const uint8_t *s, int32_t length,
+                                             int32_t pos, int32_t spanLength,
+                                             OffsetList &offsets) const {
+    if(tries->fwd8.isEmpty()) {
+        return FALSE;  // No string is representable in UTF-8.
+    }
+    const uint8_t *spanUTF8Lengths=spanLengths+2*strings.size();
+    int32_t rest=length-pos;
+    int32_t start=pos-(spanLength<maxLength8 ? spanLength : maxLength8);
+    for(; start<=pos; ++start) {
+        // Match at code point boundaries. (The UTF-8 strings were converted
+        // from UTF-16 and are guaranteed to be well-formed.)
+        if(U8_IS_TRAIL(s[start])) {
+            continue;
+        }
+        int32_t overlap=pos-start;
+        BytesTrie trie(tries->fwd8.data());
+        UStringTrieResult result=trie.first(s[start]);
+        int32_t limit=start+1;
+        for(;;) {
+            if(USTRINGTRIE_HAS_VALUE(result)) {
+                int32_t i=trie.getValue();
+                int32_t maxOverlap=spanUTF8Lengths[i];
+                if(maxOverlap!=ALL_CP_CONTAINED) {
+                    int32_t length8=limit-start;
+                    if(maxOverlap>=LONG_SPAN) {
+                        // The matched text is the string.
+                        maxOverlap=length8;
+                        U8_BACK_1(s+start, 0, maxOverlap);
+                    }
+                    int32_t inc=length8-overlap;
+                    if(overlap<=maxOverlap && !offsets.containsOffset(inc)) {
+                        if(inc==rest) {
+                            return TRUE;  // Reached the end of the string.
+                        }
+                        offsets.addOffset(inc);
+                    }
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || limit==length) {
+                break;
+            }
+            result=trie.next(s[limit++]);
+        }
+    }
+    return FALSE;
+}
+
+void UnicodeSetStringSpan::matchLongestUTF8(const uint8_t *s, int32_t length,
+                                            int32_t pos, int32_t spanLength,
+                                            int32_t &maxInc, int32_t &maxOverlap) const {
+    if(tries->fwd8.isEmpty()) {
+        return;  // No string is representable in UTF-8.
+    }
+    // Try the earliest start first; stop after the first start with a match.
+    const uint8_t *spanUTF8Lengths=spanLengths+2*strings.size();
+    int32_t start=pos-(spanLength<maxLength8 ? spanLength : maxLength8);
+    for(; start<=pos; ++start) {
+        if(U8_IS_TRAIL(s[start])) {
+            continue;  // Not a code point boundary.
+        }
+        int32_t overlap=pos-start;
+        BytesTrie trie(tries->fwd8.data());
+        UStringTrieResult result=trie.first(s[start]);
+        int32_t limit=start+1;
+        UBool found=FALSE;
+        for(;;) {
+            if(USTRINGTRIE_HAS_VALUE(result)) {
+                int32_t spanLengthByte=spanUTF8Lengths[trie.getValue()];
+                int32_t inc=limit-start-overlap;
+                if(inc>=0 && (spanLengthByte>=LONG_SPAN || overlap<=spanLengthByte)) {
+                    maxInc=inc;  // Longest match from earliest start.
+                    maxOverlap=overlap;
+                    found=TRUE;
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || limit==length) {
+                break;
+            }
+            result=trie.next(s[limit++]);
+        }
+        if(found) {
+            return;
+        }
+    }
+}
+
+UBool UnicodeSetStringSpan::matchStringsBackUTF8(const uint8_t *s, int32_t pos, int32_t spanLength,
+                                                 OffsetList &offsets) const {
+    if(tries->back8.isEmpty()) {
+        return FALSE;  // No string is representable in UTF-8.
+    }
+    const uint8_t *spanBackUTF8Lengths=spanLengths+3*strings.size();
+    int32_t limit=pos+(spanLength<maxLength8 ? spanLength : maxLength8);
+    for(; limit>=pos; --limit) {
+        int32_t overlap=limit-pos;
+        BytesTrie trie(tries->back8.data());
+        int32_t start=limit-1;
+        UStringTrieResult result=trie.first(s[start]);
+        for(;;) {
+            // Match at code point boundaries. (The UTF-8 strings were converted
+            // from UTF-16 and are guaranteed to be well-formed.)
+            if(USTRINGTRIE_HAS_VALUE(result) && !U8_IS_TRAIL(s[start])) {
+                int32_t i=trie.getValue();
+                int32_t maxOverlap=spanBackUTF8Lengths[i];
+                if(maxOverlap!=ALL_CP_CONTAINED) {
+                    int32_t length8=limit-start;
+                    if(maxOverlap>=LONG_SPAN) {
+                        // The matched text is the string.
+                        maxOverlap=length8;
+                        int32_t len1=0;
+                        U8_FWD_1(s+start, len1, maxOverlap);
+                        maxOverlap-=len1;
+                    }
+                    int32_t dec=length8-overlap;
+                    if(overlap<=maxOverlap && !offsets.containsOffset(dec)) {
+                        if(dec==pos) {
+                            return TRUE;  // Reached the start of the string.
+                        }
+                        offsets.addOffset(dec);
+                    }
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || start==0) {
+                break;
+            }
+            result=trie.next(s[--start]);
+        }
+    }
+    return FALSE;
+}
+
+void UnicodeSetStringSpan::matchLongestBackUTF8(const uint8_t *s, int32_t pos, int32_t spanLength,
+                                                int32_t &maxDec, int32_t &maxOverlap) const {
+    if(tries->back8.isEmpty()) {
+        return;  // No string is representable in UTF-8.
+    }
+    // Try the latest end first; stop after the first end with a match.
+    const uint8_t *spanBackUTF8Lengths=spanLengths+3*strings.size();
+    int32_t limit=pos+(spanLength<maxLength8 ? spanLength : maxLength8);
+    for(; limit>=pos; --limit) {
+        int32_t overlap=limit-pos;
+        BytesTrie trie(tries->back8.data());
+        int32_t start=limit-1;
+        UStringTrieResult result=trie.first(s[start]);
+        UBool found=FALSE;
+        for(;;) {
+            if(USTRINGTRIE_HAS_VALUE(result) && !U8_IS_TRAIL(s[start])) {
+                int32_t spanLengthByte=spanBackUTF8Lengths[trie.getValue()];
+                int32_t dec=limit-start-overlap;
+                if(dec>=0 && (spanLengthByte>=LONG_SPAN || overlap<=spanLengthByte)) {
+                    maxDec=dec;  // Longest match from latest end.
+                    maxOverlap=overlap;
+                    found=TRUE;
+                }
+            }
+            if(!USTRINGTRIE_HAS_NEXT(result) || start==0) {
+                break;
+            }
+            result=trie.next(s[--start]);
+        }
+        if(found) {
+            return;
+        }
+    }
+}
+
+UBool UnicodeSetStringSpan::matchesAnyString(const UChar *s, int32_t length, int32_t pos) const {
+    if(0<pos && U16_IS_LEAD(s[pos-1]) && U16_IS_TRAIL(s[pos])) {
+        return FALSE;  // Not a code point boundary.
+    }
+    UCharsTrie trie(tries->fwd16.getBuffer());
+    UStringTrieResult result=trie.first(s[pos]);
+    int32_t limit=pos+1;
+    for(;;) {
+        if( USTRINGTRIE_HAS_VALUE(result) &&
+            spanLengths[trie.getValue()]!=ALL_CP_CONTAINED &&
+            !(limit<length && U16_IS_LEAD(s[limit-1]) && U16_IS_TRAIL(s[limit]))
+        ) {
+            return TRUE;
+        }
+        if(!USTRINGTRIE_HAS_NEXT(result) || limit==length) {
+            return FALSE;
+        }
+        result=trie.next(s[limit++]);
+    }
+}
+
+UBool UnicodeSetStringSpan::matchesAnyStringBack(const UChar *s, int32_t length, int32_t pos) const {
+    if(pos<length && U16_IS_LEAD(s[pos-1]) && U16_IS_TRAIL(s[pos])) {
+        return FALSE;  // Not a code point boundary.
+    }
+    UCharsTrie trie(tries->back16.getBuffer());
+    int32_t start=pos-1;
+    UStringTrieResult result=trie.first(s[start]);
+    for(;;) {
+        // Use spanLengths rather than a spanBackLengths pointer because
+        // it is easier and we only need to know whether the string is irrelevant
+        // which is the same in either array.
+        if( USTRINGTRIE_HAS_VALUE(result) &&
+            spanLengths[trie.getValue()]!=ALL_CP_CONTAINED &&
+            !(0<start && U16_IS_LEAD(s[start-1]) && U16_IS_TRAIL(s[start]))
+        ) {
+            return TRUE;
+        }
+        if(!USTRINGTRIE_HAS_NEXT(result) || start==0) {
+            return FALSE;
+        }
+        result=trie.next(s[--start]);
+    }
+}
+
+UBool UnicodeSetStringSpan::matchesAnyStringUTF8(const uint8_t *s, int32_t length, int32_t pos) const {
+    if(tries->fwd8.isEmpty()) {
+        return FALSE;  // No string is representable in UTF-8.
+    }
+    const uint8_t *spanUTF8Lengths=spanLengths+2*strings.size();
+    BytesTrie trie(tries->fwd8.data());
+    UStringTrieResult result=trie.first(s[pos]);
+    int32_t limit=pos+1;
+    for(;;) {
+        if(USTRINGTRIE_HAS_VALUE(result) && spanUTF8Lengths[trie.getValue()]!=ALL_CP_CONTAINED) {
+            return TRUE;
+        }
+        if(!USTRINGTRIE_HAS_NEXT(result) || limit==length) {
+            return FALSE;
+        }
+        result=trie.next(s[limit++]);
+    }
+}
+
+UBool UnicodeSetStringSpan::matchesAnyStringBackUTF8(const uint8_t *s, int32_t pos) const {
+    if(tries->back8.isEmpty()) {
+        return FALSE;  // No string is representable in UTF-8.
+    }
+    const uint8_t *spanBackUTF8Lengths=spanLengths+3*strings.size();
+    BytesTrie trie(tries->back8.data());
+    int32_t start=pos-1;
+    UStringTrieResult result=trie.first(s[start]);
+    for(;;) {
+        if(USTRINGTRIE_HAS_VALUE(result) && spanBackUTF8Lengths[trie.getValue()]!=ALL_CP_CONTAINED) {
+            return TRUE;
+        }
+        if(!USTRINGTRIE_HAS_NEXT(result) || start==0) {
+            return FALSE;
+        }
+        result=trie.next(s[--start]);
+    }
+}
+
 /*
  * Note: In span() when spanLength==0 (after a string match, or at the beginning
  * after an empty code point span) and in spanNot() and spanNotUTF8(),
@@ -532,8 +1036,7 @@ spanOneBackUTF8(const UnicodeSet &set, const uint8_t *s, int32_t length) {
  * This optimization should not be necessary for normal UnicodeSets because
  * most sets have no strings, and most sets with strings have
  * very few very short strings.
- * For cases with many strings, it might be better to use a different API
- * and implementation with a DFA (state machine).
+ * For frozen sets with many strings, the trie versions above are used instead.
  */
 
 /*
@@ -648,78 +1151,88 @@ int32_t UnicodeSetStringSpan::span(const UChar *s, int32_t length, USetSpanCondi
     int32_t i, stringsLength=strings.size();
     for(;;) {
         if(spanCondition==USET_SPAN_CONTAINED) {
-            for(i=0; i<stringsLength; ++i) {
-                int32_t overlap=spanLengths[i];
-                if(overlap==ALL_CP_CONTAINED) {
-                    continue;  // Irrelevant string.
-                }
-                const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
-                const UChar *s16=string.getBuffer();
-                int32_t length16=string.length();
-
-                // Try to match this string at pos-overlap..pos.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length16;
-                    // While contained: No point matching fully inside the code point span.
-                    U16_BACK_1(s16, 0, overlap);  // Length of the string minus the last code point.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
+            if(tries!=NULL) {
+                if(matchStrings(s, length, pos, spanLength, offsets)) {
+                    return length;  // Reached the end of the string.
                 }
-                int32_t inc=length16-overlap;  // Keep overlap+inc==length16.
-                for(;;) {
-                    if(inc>rest) {
-                        break;
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    int32_t overlap=spanLengths[i];
+                    if(overlap==ALL_CP_CONTAINED) {
+                        continue;  // Irrelevant string.
                     }
-                    // Try to match if the increment is not listed already.
-                    if(!offsets.containsOffset(inc) && matches16CPB(s, pos-overlap, length, s16, length16)) {
-                        if(inc==rest) {
-                            return length;  // Reached the end of the string.
-                        }
-                        offsets.addOffset(inc);
+                    const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
+                    const UChar *s16=string.getBuffer();
+                    int32_t length16=string.length();
+
+                    // Try to match this string at pos-overlap..pos.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length16;
+                        // While contained: No point matching fully inside the code point span.
+                        U16_BACK_1(s16, 0, overlap);  // Length of the string minus the last code point.
                     }
-                    if(overlap==0) {
-                        break;
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
+                    }
+                    int32_t inc=length16-overlap;  // Keep overlap+inc==length16.
+                    for(;;) {
+                        if(inc>rest) {
+                            break;
+                        }
+                        // Try to match if the increment is not listed already.
+                        if(!offsets.containsOffset(inc) && matches16CPB(s, pos-overlap, length, s16, length16)) {
+                            if(inc==rest) {
+                                return length;  // Reached the end of the string.
+                            }
+                            offsets.addOffset(inc);
+                        }
+                        if(overlap==0) {
+                            break;
+                        }
+                        --overlap;
+                        ++inc;
                     }
-                    --overlap;
-                    ++inc;
                 }
             }
         } else /* USET_SPAN_SIMPLE */ {
             int32_t maxInc=0, maxOverlap=0;
-            for(i=0; i<stringsLength; ++i) {
-                int32_t overlap=spanLengths[i];
-                // For longest match, we do need to try to match even an all-contained string
-                // to find the match from the earliest start.
+            if(tries!=NULL) {
+                matchLongest(s, length, pos, spanLength, maxInc, maxOverlap);
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    int32_t overlap=spanLengths[i];
+                    // For longest match, we do need to try to match even an all-contained string
+                    // to find the match from the earliest start.
 
-                const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
-                const UChar *s16=string.getBuffer();
-                int32_t length16=string.length();
+                    const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
+                    const UChar *s16=string.getBuffer();
+                    int32_t length16=string.length();
 
-                // Try to match this string at pos-overlap..pos.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length16;
-                    // Longest match: Need to match fully inside the code point span
-                    // to find the match from the earliest start.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
-                }
-                int32_t inc=length16-overlap;  // Keep overlap+inc==length16.
-                for(;;) {
-                    if(inc>rest || overlap<maxOverlap) {
-                        break;
+                    // Try to match this string at pos-overlap..pos.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length16;
+                        // Longest match: Need to match fully inside the code point span
+                        // to find the match from the earliest start.
                     }
-                    // Try to match if the string is longer or starts earlier.
-                    if( (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ inc>maxInc) &&
-                        matches16CPB(s, pos-overlap, length, s16, length16)
-                    ) {
-                        maxInc=inc;  // Longest match from earliest start.
-                        maxOverlap=overlap;
-                        break;
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
+                    }
+                    int32_t inc=length16-overlap;  // Keep overlap+inc==length16.
+                    for(;;) {
+                        if(inc>rest || overlap<maxOverlap) {
+                            break;
+                        }
+                        // Try to match if the string is longer or starts earlier.
+                        if( (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ inc>maxInc) &&
+                            matches16CPB(s, pos-overlap, length, s16, length16)
+                        ) {
+                            maxInc=inc;  // Longest match from earliest start.
+                            maxOverlap=overlap;
+                            break;
+                        }
+                        --overlap;
+                        ++inc;
                     }
-                    --overlap;
-                    ++inc;
                 }
             }
 
@@ -812,80 +1325,90 @@ int32_t UnicodeSetStringSpan::spanBack(const UChar *s, int32_t length, USetSpanC
     }
     for(;;) {
         if(spanCondition==USET_SPAN_CONTAINED) {
-            for(i=0; i<stringsLength; ++i) {
-                int32_t overlap=spanBackLengths[i];
-                if(overlap==ALL_CP_CONTAINED) {
-                    continue;  // Irrelevant string.
-                }
-                const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
-                const UChar *s16=string.getBuffer();
-                int32_t length16=string.length();
-
-                // Try to match this string at pos-(length16-overlap)..pos-length16.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length16;
-                    // While contained: No point matching fully inside the code point span.
-                    int32_t len1=0;
-                    U16_FWD_1(s16, len1, overlap);
-                    overlap-=len1;  // Length of the string minus the first code point.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
+            if(tries!=NULL) {
+                if(matchStringsBack(s, length, pos, spanLength, offsets)) {
+                    return 0;  // Reached the start of the string.
                 }
-                int32_t dec=length16-overlap;  // Keep dec+overlap==length16.
-                for(;;) {
-                    if(dec>pos) {
-                        break;
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    int32_t overlap=spanBackLengths[i];
+                    if(overlap==ALL_CP_CONTAINED) {
+                        continue;  // Irrelevant string.
                     }
-                    // Try to match if the decrement is not listed already.
-                    if(!offsets.containsOffset(dec) && matches16CPB(s, pos-dec, length, s16, length16)) {
-                        if(dec==pos) {
-                            return 0;  // Reached the start of the string.
-                        }
-                        offsets.addOffset(dec);
+                    const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
+                    const UChar *s16=string.getBuffer();
+                    int32_t length16=string.length();
+
+                    // Try to match this string at pos-(length16-overlap)..pos-length16.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length16;
+                        // While contained: No point matching fully inside the code point span.
+                        int32_t len1=0;
+                        U16_FWD_1(s16, len1, overlap);
+                        overlap-=len1;  // Length of the string minus the first code point.
                     }
-                    if(overlap==0) {
-                        break;
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
+                    }
+                    int32_t dec=length16-overlap;  // Keep dec+overlap==length16.
+                    for(;;) {
+                        if(dec>pos) {
+                            break;
+                        }
+                        // Try to match if the decrement is not listed already.
+                        if(!offsets.containsOffset(dec) && matches16CPB(s, pos-dec, length, s16, length16)) {
+                            if(dec==pos) {
+                                return 0;  // Reached the start of the string.
+                            }
+                            offsets.addOffset(dec);
+                        }
+                        if(overlap==0) {
+                            break;
+                        }
+                        --overlap;
+                        ++dec;
                     }
-                    --overlap;
-                    ++dec;
                 }
             }
         } else /* USET_SPAN_SIMPLE */ {
             int32_t maxDec=0, maxOverlap=0;
-            for(i=0; i<stringsLength; ++i) {
-                int32_t overlap=spanBackLengths[i];
-                // For longest match, we do need to try to match even an all-contained string
-                // to find the match from the latest end.
+            if(tries!=NULL) {
+                matchLongestBack(s, length, pos, spanLength, maxDec, maxOverlap);
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    int32_t overlap=spanBackLengths[i];
+                    // For longest match, we do need to try to match even an all-contained string
+                    // to find the match from the latest end.
 
-                const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
-                const UChar *s16=string.getBuffer();
-                int32_t length16=string.length();
+                    const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
+                    const UChar *s16=string.getBuffer();
+                    int32_t length16=string.length();
 
-                // Try to match this string at pos-(length16-overlap)..pos-length16.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length16;
-                    // Longest match: Need to match fully inside the code point span
-                    // to find the match from the latest end.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
-                }
-                int32_t dec=length16-overlap;  // Keep dec+overlap==length16.
-                for(;;) {
-                    if(dec>pos || overlap<maxOverlap) {
-                        break;
+                    // Try to match this string at pos-(length16-overlap)..pos-length16.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length16;
+                        // Longest match: Need to match fully inside the code point span
+                        // to find the match from the latest end.
                     }
-                    // Try to match if the string is longer or ends later.
-                    if( (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ dec>maxDec) &&
-                        matches16CPB(s, pos-dec, length, s16, length16)
-                    ) {
-                        maxDec=dec;  // Longest match from latest end.
-                        maxOverlap=overlap;
-                        break;
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
+                    }
+                    int32_t dec=length16-overlap;  // Keep dec+overlap==length16.
+                    for(;;) {
+                        if(dec>pos || overlap<maxOverlap) {
+                            break;
+                        }
+                        // Try to match if the string is longer or ends later.
+                        if( (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ dec>maxDec) &&
+                            matches16CPB(s, pos-dec, length, s16, length16)
+                        ) {
+                            maxDec=dec;  // Longest match from latest end.
+                            maxOverlap=overlap;
+                            break;
+                        }
+                        --overlap;
+                        ++dec;
                     }
-                    --overlap;
-                    ++dec;
                 }
             }
 
@@ -976,93 +1499,103 @@ int32_t UnicodeSetStringSpan::spanUTF8(const uint8_t *s, int32_t length, USetSpa
         const uint8_t *s8=utf8;
         int32_t length8;
         if(spanCondition==USET_SPAN_CONTAINED) {
-            for(i=0; i<stringsLength; ++i) {
-                length8=utf8Lengths[i];
-                if(length8==0) {
-                    continue;  // String not representable in UTF-8.
-                }
-                int32_t overlap=spanUTF8Lengths[i];
-                if(overlap==ALL_CP_CONTAINED) {
-                    s8+=length8;
-                    continue;  // Irrelevant string.
+            if(tries!=NULL) {
+                if(matchStringsUTF8(s, length, pos, spanLength, offsets)) {
+                    return length;  // Reached the end of the string.
                 }
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    length8=utf8Lengths[i];
+                    if(length8==0) {
+                        continue;  // String not representable in UTF-8.
+                    }
+                    int32_t overlap=spanUTF8Lengths[i];
+                    if(overlap==ALL_CP_CONTAINED) {
+                        s8+=length8;
+                        continue;  // Irrelevant string.
+                    }
 
-                // Try to match this string at pos-overlap..pos.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length8;
-                    // While contained: No point matching fully inside the code point span.
-                    U8_BACK_1(s8, 0, overlap);  // Length of the string minus the last code point.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
-                }
-                int32_t inc=length8-overlap;  // Keep overlap+inc==length8.
-                for(;;) {
-                    if(inc>rest) {
-                        break;
+                    // Try to match this string at pos-overlap..pos.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length8;
+                        // While contained: No point matching fully inside the code point span.
+                        U8_BACK_1(s8, 0, overlap);  // Length of the string minus the last code point.
                     }
-                    // Try to match if the increment is not listed already.
-                    // Match at code point boundaries. (The UTF-8 strings were converted
-                    // from UTF-16 and are guaranteed to be well-formed.)
-                    if( !U8_IS_TRAIL(s[pos-overlap]) &&
-                        !offsets.containsOffset(inc) &&
-                        matches8(s+pos-overlap, s8, length8)
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
+                    }
+                    int32_t inc=length8-overlap;  // Keep overlap+inc==length8.
+                    for(;;) {
+                        if(inc>rest) {
+                            break;
+                        }
+                        // Try to match if the increment is not listed already.
+                        // Match at code point boundaries. (The UTF-8 strings were converted
+                        // from UTF-16 and are guaranteed to be well-formed.)
+                        if( !U8_IS_TRAIL(s[pos-overlap]) &&
+                            !offsets.containsOffset(inc) &&
+                            matches8(s+pos-overlap, s8, length8)
                         
-                    ) {
-                        if(inc==rest) {
-                            return length;  // Reached the end of the string.
+                        ) {
+                            if(inc==rest) {
+                                return length;  // Reached the end of the string.
+                            }
+                            offsets.addOffset(inc);
                         }
-                        offsets.addOffset(inc);
-                    }
-                    if(overlap==0) {
-                        break;
+                        if(overlap==0) {
+                            break;
+                        }
+                        --overlap;
+                        ++inc;
                     }
-                    --overlap;
-                    ++inc;
+                    s8+=length8;
                 }
-                s8+=length8;
             }
         } else /* USET_SPAN_SIMPLE */ {
             int32_t maxInc=0, maxOverlap=0;
-            for(i=0; i<stringsLength; ++i) {
-                length8=utf8Lengths[i];
-                if(length8==0) {
-                    continue;  // String not representable in UTF-8.
-                }
-                int32_t overlap=spanUTF8Lengths[i];
-                // For longest match, we do need to try to match even an all-contained string
-                // to find the match from the earliest start.
-
-                // Try to match this string at pos-overlap..pos.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length8;
-                    // Longest match: Need to match fully inside the code point span
+            if(tries!=NULL) {
+                matchLongestUTF8(s, length, pos, spanLength, maxInc, maxOverlap);
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    length8=utf8Lengths[i];
+                    if(length8==0) {
+                        continue;  // String not representable in UTF-8.
+                    }
+                    int32_t overlap=spanUTF8Lengths[i];
+                    // For longest match, we do need to try to match even an all-contained string
                     // to find the match from the earliest start.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
-                }
-                int32_t inc=length8-overlap;  // Keep overlap+inc==length8.
-                for(;;) {
-                    if(inc>rest || overlap<maxOverlap) {
-                        break;
+
+                    // Try to match this string at pos-overlap..pos.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length8;
+                        // Longest match: Need to match fully inside the code point span
+                        // to find the match from the earliest start.
+                    }
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
                     }
-                    // Try to match if the string is longer or starts earlier.
-                    // Match at code point boundaries. (The UTF-8 strings were converted
-                    // from UTF-16 and are guaranteed to be well-formed.)
-                    if( !U8_IS_TRAIL(s[pos-overlap]) &&
-                        (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ inc>maxInc) &&
-                        matches8(s+pos-overlap, s8, length8)
+                    int32_t inc=length8-overlap;  // Keep overlap+inc==length8.
+                    for(;;) {
+                        if(inc>rest || overlap<maxOverlap) {
+                            break;
+                        }
+                        // Try to match if the string is longer or starts earlier.
+                        // Match at code point boundaries. (The UTF-8 strings were converted
+                        // from UTF-16 and are guaranteed to be well-formed.)
+                        if( !U8_IS_TRAIL(s[pos-overlap]) &&
+                            (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ inc>maxInc) &&
+                            matches8(s+pos-overlap, s8, length8)
                         
-                    ) {
-                        maxInc=inc;  // Longest match from earliest start.
-                        maxOverlap=overlap;
-                        break;
+                        ) {
+                            maxInc=inc;  // Longest match from earliest start.
+                            maxOverlap=overlap;
+                            break;
+                        }
+                        --overlap;
+                        ++inc;
                     }
-                    --overlap;
-                    ++inc;
+                    s8+=length8;
                 }
-                s8+=length8;
             }
 
             if(maxInc!=0 || maxOverlap!=0) {
@@ -1156,93 +1689,103 @@ int32_t UnicodeSetStringSpan::spanBackUTF8(const uint8_t *s, int32_t length, USe
         const uint8_t *s8=utf8;
         int32_t length8;
         if(spanCondition==USET_SPAN_CONTAINED) {
-            for(i=0; i<stringsLength; ++i) {
-                length8=utf8Lengths[i];
-                if(length8==0) {
-                    continue;  // String not representable in UTF-8.
-                }
-                int32_t overlap=spanBackUTF8Lengths[i];
-                if(overlap==ALL_CP_CONTAINED) {
-                    s8+=length8;
-                    continue;  // Irrelevant string.
+            if(tries!=NULL) {
+                if(matchStringsBackUTF8(s, pos, spanLength, offsets)) {
+                    return 0;  // Reached the start of the string.
                 }
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    length8=utf8Lengths[i];
+                    if(length8==0) {
+                        continue;  // String not representable in UTF-8.
+                    }
+                    int32_t overlap=spanBackUTF8Lengths[i];
+                    if(overlap==ALL_CP_CONTAINED) {
+                        s8+=length8;
+                        continue;  // Irrelevant string.
+                    }
 
-                // Try to match this string at pos-(length8-overlap)..pos-length8.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length8;
-                    // While contained: No point matching fully inside the code point span.
-                    int32_t len1=0;
-                    U8_FWD_1(s8, len1, overlap);
-                    overlap-=len1;  // Length of the string minus the first code point.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
-                }
-                int32_t dec=length8-overlap;  // Keep dec+overlap==length8.
-                for(;;) {
-                    if(dec>pos) {
-                        break;
+                    // Try to match this string at pos-(length8-overlap)..pos-length8.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length8;
+                        // While contained: No point matching fully inside the code point span.
+                        int32_t len1=0;
+                        U8_FWD_1(s8, len1, overlap);
+                        overlap-=len1;  // Length of the string minus the first code point.
                     }
-                    // Try to match if the decrement is not listed already.
-                    // Match at code point boundaries. (The UTF-8 strings were converted
-                    // from UTF-16 and are guaranteed to be well-formed.)
-                    if( !U8_IS_TRAIL(s[pos-dec]) &&
-                        !offsets.containsOffset(dec) &&
-                        matches8(s+pos-dec, s8, length8)
-                    ) {
-                        if(dec==pos) {
-                            return 0;  // Reached the start of the string.
-                        }
-                        offsets.addOffset(dec);
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
                     }
-                    if(overlap==0) {
-                        break;
+                    int32_t dec=length8-overlap;  // Keep dec+overlap==length8.
+                    for(;;) {
+                        if(dec>pos) {
+                            break;
+                        }
+                        // Try to match if the decrement is not listed already.
+                        // Match at code point boundaries. (The UTF-8 strings were converted
+                        // from UTF-16 and are guaranteed to be well-formed.)
+                        if( !U8_IS_TRAIL(s[pos-dec]) &&
+                            !offsets.containsOffset(dec) &&
+                            matches8(s+pos-dec, s8, length8)
+                        ) {
+                            if(dec==pos) {
+                                return 0;  // Reached the start of the string.
+                            }
+                            offsets.addOffset(dec);
+                        }
+                        if(overlap==0) {
+                            break;
+                        }
+                        --overlap;
+                        ++dec;
                     }
-                    --overlap;
-                    ++dec;
+                    s8+=length8;
                 }
-                s8+=length8;
             }
         } else /* USET_SPAN_SIMPLE */ {
             int32_t maxDec=0, maxOverlap=0;
-            for(i=0; i<stringsLength; ++i) {
-                length8=utf8Lengths[i];
-                if(length8==0) {
-                    continue;  // String not representable in UTF-8.
-                }
-                int32_t overlap=spanBackUTF8Lengths[i];
-                // For longest match, we do need to try to match even an all-contained string
-                // to find the match from the latest end.
-
-                // Try to match this string at pos-(length8-overlap)..pos-length8.
-                if(overlap>=LONG_SPAN) {
-                    overlap=length8;
-                    // Longest match: Need to match fully inside the code point span
+            if(tries!=NULL) {
+                matchLongestBackUTF8(s, pos, spanLength, maxDec, maxOverlap);
+            } else {
+                for(i=0; i<stringsLength; ++i) {
+                    length8=utf8Lengths[i];
+                    if(length8==0) {
+                        continue;  // String not representable in UTF-8.
+                    }
+                    int32_t overlap=spanBackUTF8Lengths[i];
+                    // For longest match, we do need to try to match even an all-contained string
                     // to find the match from the latest end.
-                }
-                if(overlap>spanLength) {
-                    overlap=spanLength;
-                }
-                int32_t dec=length8-overlap;  // Keep dec+overlap==length8.
-                for(;;) {
-                    if(dec>pos || overlap<maxOverlap) {
-                        break;
+
+                    // Try to match this string at pos-(length8-overlap)..pos-length8.
+                    if(overlap>=LONG_SPAN) {
+                        overlap=length8;
+                        // Longest match: Need to match fully inside the code point span
+                        // to find the match from the latest end.
                     }
-                    // Try to match if the string is longer or ends later.
-                    // Match at code point boundaries. (The UTF-8 strings were converted
-                    // from UTF-16 and are guaranteed to be well-formed.)
-                    if( !U8_IS_TRAIL(s[pos-dec]) &&
-                        (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ dec>maxDec) &&
-                        matches8(s+pos-dec, s8, length8)
-                    ) {
-                        maxDec=dec;  // Longest match from latest end.
-                        maxOverlap=overlap;
-                        break;
+                    if(overlap>spanLength) {
+                        overlap=spanLength;
                     }
-                    --overlap;
-                    ++dec;
+                    int32_t dec=length8-overlap;  // Keep dec+overlap==length8.
+                    for(;;) {
+                        if(dec>pos || overlap<maxOverlap) {
+                            break;
+                        }
+                        // Try to match if the string is longer or ends later.
+                        // Match at code point boundaries. (The UTF-8 strings were converted
+                        // from UTF-16 and are guaranteed to be well-formed.)
+                        if( !U8_IS_TRAIL(s[pos-dec]) &&
+                            (overlap>maxOverlap || /* redundant overlap==maxOverlap && */ dec>maxDec) &&
+                            matches8(s+pos-dec, s8, length8)
+                        ) {
+                            maxDec=dec;  // Longest match from latest end.
+                            maxOverlap=overlap;
+                            break;
+                        }
+                        --overlap;
+                        ++dec;
+                    }
+                    s8+=length8;
                 }
-                s8+=length8;
             }
 
             if(maxDec!=0 || maxOverlap!=0) {
@@ -1357,16 +1900,22 @@ int32_t UnicodeSetStringSpan::spanNot(const UChar *s, int32_t length) const {
         }
 
         // Try to match the strings at pos.
-        for(i=0; i<stringsLength; ++i) {
-            if(spanLengths[i]==ALL_CP_CONTAINED) {
-                continue;  // Irrelevant string.
-            }
-            const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
-            const UChar *s16=string.getBuffer();
-            int32_t length16=string.length();
-            if(length16<=rest && matches16CPB(s, pos, length, s16, length16)) {
+        if(tries!=NULL) {
+            if(matchesAnyString(s, length, pos)) {
                 return pos;  // There is a set element at pos.
             }
+        } else {
+            for(i=0; i<stringsLength; ++i) {
+                if(spanLengths[i]==ALL_CP_CONTAINED) {
+                    continue;  // Irrelevant string.
+                }
+                const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
+                const UChar *s16=string.getBuffer();
+                int32_t length16=string.length();
+                if(length16<=rest && matches16CPB(s, pos, length, s16, length16)) {
+                    return pos;  // There is a set element at pos.
+                }
+            }
         }
 
         // The span(while not contained) ended on a string start/end which is
@@ -1397,19 +1946,25 @@ int32_t UnicodeSetStringSpan::spanNotBack(const UChar *s, int32_t length) const
         }
 
         // Try to match the strings at pos.
-        for(i=0; i<stringsLength; ++i) {
-            // Use spanLengths rather than a spanBackLengths pointer because
-            // it is easier and we only need to know whether the string is irrelevant
-            // which is the same in either array.
-            if(spanLengths[i]==ALL_CP_CONTAINED) {
-                continue;  // Irrelevant string.
-            }
-            const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
-            const UChar *s16=string.getBuffer();
-            int32_t length16=string.length();
-            if(length16<=pos && matches16CPB(s, pos-length16, length, s16, length16)) {
+        if(tries!=NULL) {
+            if(matchesAnyStringBack(s, length, pos)) {
                 return pos;  // There is a set element at pos.
             }
+        } else {
+            for(i=0; i<stringsLength; ++i) {
+                // Use spanLengths rather than a spanBackLengths pointer because
+                // it is easier and we only need to know whether the string is irrelevant
+                // which is the same in either array.
+                if(spanLengths[i]==ALL_CP_CONTAINED) {
+                    continue;  // Irrelevant string.
+                }
+                const UnicodeString &string=*(const UnicodeString *)strings.elementAt(i);
+                const UChar *s16=string.getBuffer();
+                int32_t length16=string.length();
+                if(length16<=pos && matches16CPB(s, pos-length16, length, s16, length16)) {
+                    return pos;  // There is a set element at pos.
+                }
+            }
         }
 
         // The span(while not contained) ended on a string start/end which is
@@ -1445,15 +2000,21 @@ int32_t UnicodeSetStringSpan::spanNotUTF8(const uint8_t *s, int32_t length) cons
         }
 
         // Try to match the strings at pos.
-        const uint8_t *s8=utf8;
-        int32_t length8;
-        for(i=0; i<stringsLength; ++i) {
-            length8=utf8Lengths[i];
-            // ALL_CP_CONTAINED: Irrelevant string.
-            if(length8!=0 && spanUTF8Lengths[i]!=ALL_CP_CONTAINED && length8<=rest && matches8(s+pos, s8, length8)) {
+        if(tries!=NULL) {
+            if(matchesAnyStringUTF8(s, length, pos)) {
                 return pos;  // There is a set element at pos.
             }
-            s8+=length8;
+        } else {
+            const uint8_t *s8=utf8;
+            int32_t length8;
+            for(i=0; i<stringsLength; ++i) {
+                length8=utf8Lengths[i];
+                // ALL_CP_CONTAINED: Irrelevant string.
+                if(length8!=0 && spanUTF8Lengths[i]!=ALL_CP_CONTAINED && length8<=rest && matches8(s+pos, s8, length8)) {
+                    return pos;  // There is a set element at pos.
+                }
+                s8+=length8;
+            }
         }
 
         // The span(while not contained) ended on a string start/end which is
@@ -1488,15 +2049,21 @@ int32_t UnicodeSetStringSpan::spanNotBackUTF8(const uint8_t *s, int32_t length)
         }
 
         // Try to match the strings at pos.
-        const uint8_t *s8=utf8;
-        int32_t length8;
-        for(i=0; i<stringsLength; ++i) {
-            length8=utf8Lengths[i];
-            // ALL_CP_CONTAINED: Irrelevant string.
-            if(length8!=0 && spanBackUTF8Lengths[i]!=ALL_CP_CONTAINED && length8<=pos && matches8(s+pos-length8, s8, length8)) {
+        if(tries!=NULL) {
+            if(matchesAnyStringBackUTF8(s, pos)) {
                 return pos;  // There is a set element at pos.
             }
-            s8+=length8;
+        } else {
+            const uint8_t *s8=utf8;
+            int32_t length8;
+            for(i=0; i<stringsLength; ++i) {
+                length8=utf8Lengths[i];
+                // ALL_CP_CONTAINED: Irrelevant string.
+                if(length8!=0 && spanBackUTF8Lengths[i]!=ALL_CP_CONTAINED && length8<=pos && matches8(s+pos-length8, s8, length8)) {
+                    return pos;  // There is a set element at pos.
+                }
+                s8+=length8;
+            }
         }
 
         // The span(while not contained) ended on a string start/end which is
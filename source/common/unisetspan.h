@@ -22,6 +22,9 @@
 
 U_NAMESPACE_BEGIN
 
+class OffsetList;
+class UnicodeSetStringTries;
+
 /*
  * Implement span() etc. for a set with strings.
  * Avoid recursion because of its exponential complexity.
@@ -93,6 +96,37 @@ private:
     // so that a character span ends before any string.
     void addToSpanNotSet(UChar32 c);
 
+    // Build the tries for a frozen set with many strings.
+    // Leaves tries==NULL if that fails.
+    void buildTries();
+
+    // Trie versions of the loops over all strings, used if tries!=NULL.
+    // The USET_SPAN_CONTAINED versions add the offsets of the string matches
+    // and return TRUE if a string match reached the end (start) of s.
+    // The USET_SPAN_SIMPLE versions find the longest match from the earliest start
+    // (latest end) and return it via maxInc (maxDec) and maxOverlap.
+    // The spanNot versions return TRUE if a relevant string matches at pos.
+    UBool matchStrings(const UChar *s, int32_t length, int32_t pos, int32_t spanLength,
+                       OffsetList &offsets) const;
+    void matchLongest(const UChar *s, int32_t length, int32_t pos, int32_t spanLength,
+                      int32_t &maxInc, int32_t &maxOverlap) const;
+    UBool matchStringsBack(const UChar *s, int32_t length, int32_t pos, int32_t spanLength,
+                           OffsetList &offsets) const;
+    void matchLongestBack(const UChar *s, int32_t length, int32_t pos, int32_t spanLength,
+                          int32_t &maxDec, int32_t &maxOverlap) const;
+    UBool matchStringsUTF8(const uint8_t *s, int32_t length, int32_t pos, int32_t spanLength,
+                           OffsetList &offsets) const;
+    void matchLongestUTF8(const uint8_t *s, int32_t length, int32_t pos, int32_t spanLength,
+                          int32_t &maxInc, int32_t &maxOverlap) const;
+    UBool matchStringsBackUTF8(const uint8_t *s, int32_t pos, int32_t spanLength,
+                               OffsetList &offsets) const;
+    void matchLongestBackUTF8(const uint8_t *s, int32_t pos, int32_t spanLength,
+                              int32_t &maxDec, int32_t &maxOverlap) const;
+    UBool matchesAnyString(const UChar *s, int32_t length, int32_t pos) const;
+    UBool matchesAnyStringBack(const UChar *s, int32_t length, int32_t pos) const;
+    UBool matchesAnyStringUTF8(const uint8_t *s, int32_t length, int32_t pos) const;
+    UBool matchesAnyStringBackUTF8(const uint8_t *s, int32_t pos) const;
+
     int32_t spanNot(const UChar *s, int32_t length) const;
     int32_t spanNotBack(const UChar *s, int32_t length) const;
     int32_t spanNotUTF8(const uint8_t *s, int32_t length) const;
@@ -131,6 +165,11 @@ private:
     // Set up for all variants of span()?
     UBool all;
 
+    // For a frozen set with many strings: Tries over the strings,
+    // so that all strings are matched at a position with one trie walk
+    // rather than one comparison per string. NULL if not used.
+    UnicodeSetStringTries *tries;
+
     // Memory for small numbers and lengths of strings.
     // For example, for 8 strings:
     // 8 UTF-8 lengths, 8*4 bytes span lengths, 8*2 3-byte UTF-8 characters
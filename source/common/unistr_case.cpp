@@ -148,6 +148,15 @@ UnicodeString::foldCase(uint32_t options) {
   return caseMap(&csm, ustrcase_internalFold);
 }
 
+int32_t
+UnicodeString::caseFoldedHashCode(uint32_t options) const {
+  int32_t hashCode = u_strFoldCaseHash(getArrayStart(), length(), options);
+  if (hashCode == kInvalidHashCode) {
+    hashCode = kEmptyHashCode;
+  }
+  return hashCode;
+}
+
 U_NAMESPACE_END
 
 // Defined here to reduce dependencies on break iterator
@@ -158,10 +167,7 @@ uhash_hashCaselessUnicodeString(const UElement key) {
     if (str == NULL) {
         return 0;
     }
-    // Inefficient; a better way would be to have a hash function in
-    // UnicodeString that does case folding on the fly.
-    UnicodeString copy(*str);
-    return copy.foldCase().hashCode();
+    return str->caseFoldedHashCode(U_FOLD_CASE_DEFAULT);
 }
 
 // Defined here to reduce dependencies on break iterator
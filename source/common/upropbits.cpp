@@ -0,0 +1,445 @@
+/*
+*******************************************************************************
+*
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+*
+*******************************************************************************
+*   file name:  upropbits.cpp
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2016jan18
+*
+*   Precompiled lookup of a chosen set of binary and enumerated properties:
+*   The properties' code point ranges are collected in a UPropsVectors
+*   with one column of property bits, and compacted into a single
+*   32-bit UTrie2 whose values are the property bits themselves.
+*   Each property has a bit field just wide enough for its maximum value,
+*   so a binary property takes one bit and General_Category takes five.
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/uchar.h"
+#include "unicode/uniset.h"
+#include "unicode/upropbits.h"
+#include "unicode/ustring.h"
+#include "cmemory.h"
+#include "propsvec.h"
+#include "ucmndata.h"
+#include "utrie2.h"
+
+U_NAMESPACE_USE
+
+enum {
+    UPBITS_MAX_PROPERTIES=32
+};
+
+struct UPropertyBits {
+    UTrie2 *trie;  // 32-bit trie with the property bits
+    int32_t propertiesCount;
+    int32_t properties[UPBITS_MAX_PROPERTIES];
+    int32_t widths[UPBITS_MAX_PROPERTIES];  // bit field widths
+    int32_t shifts[UPBITS_MAX_PROPERTIES];  // sums of the preceding widths, not serialized
+};
+
+/**
+ * Sets the shifts from the widths.
+ * @return FALSE if a width is out of range or the fields do not fit into 32 bits
+ */
+static UBool
+upbits_setShifts(UPropertyBits *pbits) {
+    int32_t shift=0;
+    for(int32_t i=0; i<pbits->propertiesCount; ++i) {
+        int32_t width=pbits->widths[i];
+        if(width<=0 || 32<(shift+width)) {
+            return FALSE;
+        }
+        pbits->shifts[i]=shift;
+        shift+=width;
+    }
+    return TRUE;
+}
+
+static inline UBool
+upbits_isSupportedProperty(int32_t property) {
+    return
+        (UCHAR_BINARY_START<=property && property<UCHAR_BINARY_LIMIT) ||
+        (UCHAR_INT_START<=property && property<UCHAR_INT_LIMIT);
+}
+
+U_CDECL_BEGIN
+
+struct UPBitsToUTrie2Context {
+    UTrie2 *trie;
+    uint32_t initialValue;
+    uint32_t errorValue;
+};
+
+/*
+ * Like upvec_compactToUTrie2Handler() but stores the row values
+ * rather than the row indexes, for a single-column UPropsVectors.
+ */
+static void U_CALLCONV
+upbits_compactHandler(void *context,
+                      UChar32 start, UChar32 end,
+                      int32_t /*rowIndex*/, uint32_t *row, int32_t /*columns*/,
+                      UErrorCode *pErrorCode) {
+    UPBitsToUTrie2Context *toUTrie2=(UPBitsToUTrie2Context *)context;
+    if(start<UPVEC_FIRST_SPECIAL_CP) {
+        if(row[0]!=toUTrie2->initialValue) {
+            utrie2_setRange32(toUTrie2->trie, start, end, row[0], TRUE, pErrorCode);
+        }
+    } else {
+        switch(start) {
+        case UPVEC_INITIAL_VALUE_CP:
+            toUTrie2->initialValue=row[0];
+            break;
+        case UPVEC_ERROR_VALUE_CP:
+            toUTrie2->errorValue=row[0];
+            break;
+        case UPVEC_START_REAL_VALUES_CP:
+            toUTrie2->trie=utrie2_open(toUTrie2->initialValue,
+                                       toUTrie2->errorValue, pErrorCode);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+U_CDECL_END
+
+U_CAPI UPropertyBits * U_EXPORT2
+upbits_open(const UProperty *properties, int32_t count, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    if(properties==NULL || count<=0 || UPBITS_MAX_PROPERTIES<count) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    LocalUPropertyBitsPointer pbits((UPropertyBits *)uprv_malloc(sizeof(UPropertyBits)));
+    if(pbits.isNull()) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memset(pbits.getAlias(), 0, sizeof(UPropertyBits));
+    pbits->propertiesCount=count;
+
+    int32_t i;
+    for(i=0; i<count; ++i) {
+        if(!upbits_isSupportedProperty(properties[i])) {
+            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return NULL;
+        }
+        pbits->properties[i]=properties[i];
+        // Enough bits for the maximum value; 1 for a binary property.
+        int32_t maxValue=u_getIntPropertyMaxValue(properties[i]);
+        int32_t width=1;
+        while(width<32 && (maxValue>>width)!=0) {
+            ++width;
+        }
+        pbits->widths[i]=width;
+    }
+    if(!upbits_setShifts(pbits.getAlias())) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+
+    // Value 0 is the initial value, so only the other values need to be set.
+    UPropsVectors *pv=upvec_open(1, pErrorCode);
+    UnicodeSet set;
+    for(i=0; i<count && U_SUCCESS(*pErrorCode); ++i) {
+        int32_t shift=pbits->shifts[i];
+        uint32_t mask=(((uint32_t)1<<(pbits->widths[i]-1))*2-1)<<shift;
+        int32_t maxValue=u_getIntPropertyMaxValue(properties[i]);
+        for(int32_t value=1; value<=maxValue && U_SUCCESS(*pErrorCode); ++value) {
+            set.applyIntPropertyValue(properties[i], value, *pErrorCode);
+            int32_t rangeCount=set.getRangeCount();
+            for(int32_t j=0; j<rangeCount && U_SUCCESS(*pErrorCode); ++j) {
+                upvec_setValue(pv, set.getRangeStart(j), set.getRangeEnd(j),
+                               0, (uint32_t)value<<shift, mask, pErrorCode);
+            }
+        }
+    }
+    UPBitsToUTrie2Context toUTrie2={ NULL, 0, 0 };
+    upvec_compact(pv, upbits_compactHandler, &toUTrie2, pErrorCode);
+    upvec_close(pv);
+    pbits->trie=toUTrie2.trie;
+    if(U_SUCCESS(*pErrorCode)) {
+        utrie2_freeze(pbits->trie, UTRIE2_32_VALUE_BITS, pErrorCode);
+    }
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    return pbits.orphan();
+}
+
+U_CAPI void U_EXPORT2
+upbits_close(UPropertyBits *pbits) {
+    if(pbits!=NULL) {
+        utrie2_close(pbits->trie);
+        uprv_free(pbits);
+    }
+}
+
+static const UDataInfo dataInfo={
+    sizeof(UDataInfo),
+    0,
+
+    U_IS_BIG_ENDIAN,
+    U_CHARSET_FAMILY,
+    U_SIZEOF_UCHAR,
+    0,
+
+    { 0x50, 0x42, 0x69, 0x74 },   /* dataFormat="PBit" */
+    { 2, 0, 0, 0 },               /* formatVersion */
+    { 0, 0, 0, 0 }                /* dataVersion */
+};
+
+enum {
+    UPBITS_INDEX_TRIE_SIZE,         // trie size in bytes
+    UPBITS_INDEX_PROPERTIES_COUNT,  // number of properties
+    UPBITS_INDEX_SIZE=7,            // bytes following the DataHeader
+    UPBITS_INDEX_COUNT=8
+};
+
+/*
+ * Serialized form of a UPropertyBits, formatVersion 2:
+ *
+ * The serialized form begins with a standard ICU DataHeader with a UDataInfo
+ * as the template above.
+ * This is followed by:
+ *   int32_t indexes[UPBITS_INDEX_COUNT];   // see index entry constants above
+ *   int32_t properties[UPBITS_MAX_PROPERTIES];
+ *   int32_t widths[UPBITS_MAX_PROPERTIES]; // bit field widths; the shifts are their sums
+ *   serialized UTrie2;                     // indexes[UPBITS_INDEX_TRIE_SIZE] bytes
+ *
+ * Changes from formatVersion 1 (never released):
+ * - Added the widths for enumerated properties.
+ *
+ * There is no swapper: The data must be used on a machine with
+ * the same endianness and charset family as where it was serialized.
+ */
+
+U_CAPI int32_t U_EXPORT2
+upbits_serialize(const UPropertyBits *pbits,
+                 void *buffer, int32_t bufferCapacity, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    uint8_t *p=(uint8_t *)buffer;
+    if( pbits==NULL || bufferCapacity<0 ||
+        (bufferCapacity>0 && (p==NULL || (U_POINTER_MASK_LSB(p, 3)!=0)))
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t serializedTrieSize=utrie2_serialize(pbits->trie, NULL, 0, pErrorCode);
+    if(*pErrorCode!=U_BUFFER_OVERFLOW_ERROR && U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    *pErrorCode=U_ZERO_ERROR;
+
+    DataHeader header;
+    uprv_memset(&header, 0, sizeof(header));
+    header.dataHeader.headerSize=(uint16_t)((sizeof(header)+15)&~15);
+    header.dataHeader.magic1=0xda;
+    header.dataHeader.magic2=0x27;
+    uprv_memcpy(&header.info, &dataInfo, sizeof(dataInfo));
+
+    int32_t indexes[UPBITS_INDEX_COUNT]={
+        serializedTrieSize,
+        pbits->propertiesCount
+    };
+    int32_t totalSize=
+        header.dataHeader.headerSize+
+        (int32_t)sizeof(indexes)+
+        (int32_t)sizeof(pbits->properties)+
+        (int32_t)sizeof(pbits->widths)+
+        serializedTrieSize;
+    indexes[UPBITS_INDEX_SIZE]=totalSize-header.dataHeader.headerSize;
+    if(totalSize>bufferCapacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        return totalSize;
+    }
+
+    int32_t length=header.dataHeader.headerSize;
+    uprv_memcpy(p, &header, sizeof(header));
+    uprv_memset(p+sizeof(header), 0, length-sizeof(header));
+    p+=length;
+
+    length=(int32_t)sizeof(indexes);
+    uprv_memcpy(p, indexes, length);
+    p+=length;
+
+    length=(int32_t)sizeof(pbits->properties);
+    uprv_memcpy(p, pbits->properties, length);
+    p+=length;
+
+    length=(int32_t)sizeof(pbits->widths);
+    uprv_memcpy(p, pbits->widths, length);
+    p+=length;
+
+    utrie2_serialize(pbits->trie, p, serializedTrieSize, pErrorCode);
+    return totalSize;
+}
+
+U_CAPI UPropertyBits * U_EXPORT2
+upbits_openFromSerialized(const void *buffer, int32_t length, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    const uint8_t *p=(const uint8_t *)buffer;
+    if(length<=0 || p==NULL || (U_POINTER_MASK_LSB(p, 3)!=0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    if(length<32) {
+        // not even enough space for a minimal header
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return NULL;
+    }
+    const DataHeader *pHeader=(const DataHeader *)p;
+    const UDataInfo *pInfo=&pHeader->info;
+    if(!(
+        pHeader->dataHeader.magic1==0xda &&
+        pHeader->dataHeader.magic2==0x27 &&
+        pInfo->isBigEndian==U_IS_BIG_ENDIAN &&
+        pInfo->charsetFamily==U_CHARSET_FAMILY &&
+        pInfo->dataFormat[0]==0x50 &&
+        pInfo->dataFormat[1]==0x42 &&
+        pInfo->dataFormat[2]==0x69 &&
+        pInfo->dataFormat[3]==0x74
+    )) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    if(pInfo->formatVersion[0]!=2) {
+        *pErrorCode=U_UNSUPPORTED_ERROR;
+        return NULL;
+    }
+    const int32_t fixedSize=(int32_t)sizeof(int32_t)*(UPBITS_INDEX_COUNT+2*UPBITS_MAX_PROPERTIES);
+    int32_t headerSize=pHeader->dataHeader.headerSize;
+    if(length<(headerSize+fixedSize)) {
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return NULL;
+    }
+    p+=headerSize;
+    length-=headerSize;
+    const int32_t *indexes=(const int32_t *)p;
+    if(length<indexes[UPBITS_INDEX_SIZE]) {
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return NULL;
+    }
+    // The trie must fit into the data after the fixed-size arrays.
+    int32_t trieSize=indexes[UPBITS_INDEX_TRIE_SIZE];
+    if(trieSize<=0 || (indexes[UPBITS_INDEX_SIZE]-fixedSize)<trieSize) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+    int32_t count=indexes[UPBITS_INDEX_PROPERTIES_COUNT];
+    if(count<=0 || UPBITS_MAX_PROPERTIES<count) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    LocalUPropertyBitsPointer pbits((UPropertyBits *)uprv_malloc(sizeof(UPropertyBits)));
+    if(pbits.isNull()) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memset(pbits.getAlias(), 0, sizeof(UPropertyBits));
+    pbits->propertiesCount=count;
+    p+=UPBITS_INDEX_COUNT*4;
+    uprv_memcpy(pbits->properties, p, sizeof(pbits->properties));
+    p+=sizeof(pbits->properties);
+    uprv_memcpy(pbits->widths, p, sizeof(pbits->widths));
+    p+=sizeof(pbits->widths);
+    for(int32_t i=0; i<count; ++i) {
+        if(!upbits_isSupportedProperty(pbits->properties[i])) {
+            *pErrorCode=U_INVALID_FORMAT_ERROR;
+            return NULL;
+        }
+    }
+    if(!upbits_setShifts(pbits.getAlias())) {
+        *pErrorCode=U_INVALID_FORMAT_ERROR;
+        return NULL;
+    }
+
+    pbits->trie=utrie2_openFromSerialized(UTRIE2_32_VALUE_BITS,
+                                          p, trieSize, NULL,
+                                          pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return NULL;
+    }
+    return pbits.orphan();
+}
+
+U_CAPI int32_t U_EXPORT2
+upbits_countProperties(const UPropertyBits *pbits) {
+    return pbits->propertiesCount;
+}
+
+U_CAPI UProperty U_EXPORT2
+upbits_getProperty(const UPropertyBits *pbits, int32_t i) {
+    if(0<=i && i<pbits->propertiesCount) {
+        return (UProperty)pbits->properties[i];
+    } else {
+        return UCHAR_INVALID_CODE;
+    }
+}
+
+U_CAPI uint32_t U_EXPORT2
+upbits_get(const UPropertyBits *pbits, UChar32 c) {
+    return UTRIE2_GET32(pbits->trie, c);
+}
+
+U_CAPI int32_t U_EXPORT2
+upbits_getValue(const UPropertyBits *pbits, uint32_t bits, int32_t i) {
+    if(0<=i && i<pbits->propertiesCount) {
+        uint32_t mask=((uint32_t)1<<(pbits->widths[i]-1))*2-1;
+        return (int32_t)((bits>>pbits->shifts[i])&mask);
+    } else {
+        return 0;
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+u_getPropertyBitsBulk(const UPropertyBits *pbits,
+                      const UChar *s, int32_t length,
+                      uint32_t *dest, int32_t destCapacity,
+                      UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( pbits==NULL || (s==NULL && length!=0) || length<-1 ||
+        destCapacity<0 || (dest==NULL && destCapacity>0)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(length<0) {
+        length=u_strlen(s);
+    }
+    if(length>destCapacity) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+        return length;
+    }
+    const UTrie2 *trie=pbits->trie;
+    const UChar *src=s;
+    const UChar *limit=s+length;
+    while(src<limit) {
+        const UChar *start=src;
+        UChar32 c;
+        uint32_t bits;
+        UTRIE2_U16_NEXT32(trie, src, limit, c, bits);
+        dest[start-s]=bits;
+        if(src-start==2) {
+            dest[start-s+1]=bits;
+        }
+    }
+    return length;
+}
@@ -458,6 +458,35 @@ u_strFoldCase(UChar *dest, int32_t destCapacity,
  * the normalization code.
  */
 
+/*
+ * Returns the case folding of a BMP code unit c if it is a single,
+ * non-surrogate BMP code point, otherwise returns -1.
+ * Used for the fast prefix loop in _cmpFold() and for u_strFoldCaseHash().
+ * ASCII is folded without a data lookup, except for U+0049 'I' which
+ * folds differently with U_FOLD_CASE_EXCLUDE_SPECIAL_I.
+ */
+static inline int32_t
+simpleFoldBMP(const UCaseProps *csp, UChar32 c, uint32_t options) {
+    if(c<=0x7f) {
+        if(c<0x41 || 0x5a<c) {
+            return c;
+        } else if(c!=0x49 || (options&_FOLD_CASE_OPTIONS_MASK)==U_FOLD_CASE_DEFAULT) {
+            return c+0x20;
+        }
+    } else if(U_IS_SURROGATE(c)) {
+        return -1;
+    }
+    const UChar *p;
+    int32_t result=ucase_toFullFolding(csp, c, &p, options);
+    if(result<0) {
+        return c;  /* no mapping, c folds to itself */
+    } else if(result>UCASE_MAX_STRING_LENGTH && result<=0xffff && !U_IS_SURROGATE(result)) {
+        return result;
+    } else {
+        return -1;  /* folds to a string or to a supplementary code point */
+    }
+}
+
 /* stack element for previous-level source/decomposition pointers */
 struct CmpEquivLevel {
     const UChar *start, *s, *limit;
@@ -545,6 +574,45 @@ static int32_t _cmpFold(
         limit2=s2+length2;
     }
 
+    /*
+     * Fast path: Skip the common prefix of code units that are either equal
+     * or that fold to the same single BMP code point.
+     * This avoids the level stack and folding buffers for the typical
+     * case of strings that differ only in the case of BMP letters.
+     * As soon as either code unit is a NUL, a surrogate or has a
+     * multi-code point case folding, continue with the full loop below,
+     * which starts from scratch at level 0 with the current positions.
+     * When both code units have single BMP foldings that differ,
+     * the result is the same as the full loop would compute:
+     * The code point order fix-up would subtract 0x2800 from both values.
+     */
+    while(s1!=limit1 && s2!=limit2) {
+        c1=*s1;
+        c2=*s2;
+        if(c1==0 || c2==0) {
+            break;
+        }
+        if(c1!=c2) {
+            cp1=simpleFoldBMP(csp, c1, options);
+            if(cp1<0) {
+                break;
+            }
+            cp2=simpleFoldBMP(csp, c2, options);
+            if(cp2<0) {
+                break;
+            }
+            if(cp1!=cp2) {
+                if(matchLen1) {
+                    *matchLen1=(int32_t)(s1-org1);
+                    *matchLen2=(int32_t)(s2-org2);
+                }
+                return cp1-cp2;
+            }
+        }
+        m1=++s1;
+        m2=++s2;
+    }
+
     level1=level2=0;
     c1=c2=-1;
 
@@ -896,6 +964,55 @@ u_strncasecmp(const UChar *s1, const UChar *s2, int32_t n, uint32_t options) {
                         &errorCode);
 }
 
+U_CAPI int32_t U_EXPORT2
+u_strFoldCaseHash(const UChar *s, int32_t length, uint32_t options) {
+    if(s==NULL || length<-1) {
+        return 0;
+    }
+    const UCaseProps *csp=ucase_getSingleton();
+    const UChar *limit= length<0 ? NULL : s+length;
+    /*
+     * Same as ustr_hashUCharsN() but over the case-folded code units
+     * and without sampling, since the folded length is not known up front.
+     */
+    uint32_t hash=0;
+    while(s!=limit) {
+        UChar32 c=*s++;
+        if(c==0 && limit==NULL) {
+            break;
+        }
+        int32_t fold=simpleFoldBMP(csp, c, options);
+        if(fold>=0) {
+            hash=hash*37+(uint32_t)fold;
+            continue;
+        }
+        UChar c2;
+        if(U16_IS_LEAD(c) && s!=limit && U16_IS_TRAIL(c2=*s)) {
+            ++s;
+            c=U16_GET_SUPPLEMENTARY(c, c2);
+        }
+        const UChar *p;
+        int32_t result=ucase_toFullFolding(csp, c, &p, options);
+        if(result<0) {
+            c=~result;
+        } else if(result>UCASE_MAX_STRING_LENGTH) {
+            c=result;
+        } else {
+            for(int32_t i=0; i<result; ++i) {
+                hash=hash*37+p[i];
+            }
+            continue;
+        }
+        if(c<=0xffff) {
+            hash=hash*37+(uint32_t)c;
+        } else {
+            hash=hash*37+U16_LEAD(c);
+            hash=hash*37+U16_TRAIL(c);
+        }
+    }
+    return (int32_t)hash;
+}
+
 /* internal API - detect length of shared prefix */
 U_CAPI void
 u_caseInsensitivePrefixMatch(const UChar *s1, int32_t length1,
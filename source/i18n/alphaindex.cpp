@@ -21,7 +21,9 @@
 #include "unicode/usetiter.h"
 #include "unicode/utf16.h"
 
+#include "charstr.h"
 #include "cmemory.h"
+#include "collation.h"
 #include "cstring.h"
 #include "uassert.h"
 #include "uvector.h"
@@ -124,7 +126,8 @@ int32_t binarySearch(const UVector &list, const UnicodeString &s, const Collator
 class BucketList : public UObject {
 public:
     BucketList(UVector *bucketList, UVector *publicBucketList)
-            : bucketList_(bucketList), immutableVisibleList_(publicBucketList) {
+            : bucketList_(bucketList), immutableVisibleList_(publicBucketList),
+              maxBoundaryKeyLength_(0) {
         int32_t displayIndex = 0;
         for (int32_t i = 0; i < publicBucketList->size(); ++i) {
             getBucket(*publicBucketList, i)->displayIndex_ = displayIndex++;
@@ -162,10 +165,51 @@ public:
         return bucket->displayIndex_;
     }
 
+    UBool computeBoundaryKeys(const Collator &collatorPrimaryOnly, UErrorCode &errorCode);
+
+    /**
+     * Like getBucketIndex(), for a name's primary sort key without the terminator.
+     * The key may be truncated to more than getMaxBoundaryKeyLength() bytes.
+     */
+    int32_t getBucketIndex(const char *key, int32_t length) const {
+        // binary search
+        int32_t start = 0;
+        int32_t limit = bucketList_->size();
+        while ((start + 1) < limit) {
+            int32_t i = (start + limit) / 2;
+            const char *boundaryKey = boundaryKeys_.data() + boundaryKeyLimits_[i - 1];
+            int32_t boundaryLength = boundaryKeyLimits_[i] - boundaryKeyLimits_[i - 1];
+            int32_t minLength = length < boundaryLength ? length : boundaryLength;
+            int32_t diff = uprv_memcmp(key, boundaryKey, minLength);
+            if (diff < 0 || (diff == 0 && length < boundaryLength)) {
+                limit = i;
+            } else {
+                start = i;
+            }
+        }
+        const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, start);
+        if (bucket->displayBucket_ != NULL) {
+            bucket = bucket->displayBucket_;
+        }
+        return bucket->displayIndex_;
+    }
+
+    int32_t getMaxBoundaryKeyLength() const { return maxBoundaryKeyLength_; }
+
     /** All of the buckets, visible and invisible. */
     UVector *bucketList_;
     /** Just the visible buckets. */
     UVector *immutableVisibleList_;
+
+private:
+    /**
+     * Primary sort keys (without terminators) of the lower boundaries of the bucketList_,
+     * concatenated. Key i ends at boundaryKeyLimits_[i].
+     * The first bucket's key is not used.
+     */
+    CharString boundaryKeys_;
+    LocalMemory<int32_t> boundaryKeyLimits_;
+    int32_t maxBoundaryKeyLength_;
 };
 
 BucketList::~BucketList() {
@@ -200,6 +244,305 @@ AlphabeticIndex::ImmutableIndex::getBucket(int32_t index) const {
     }
 }
 
+namespace {
+
+/**
+ * A record copy for the PrefixIndex, with its primary sort key.
+ */
+struct PrefixRecord : public UMemory {
+    PrefixRecord(const UnicodeString &n, const void *d, int32_t i)
+            : name(n), data(d), inputIndex(i) {}
+
+    UnicodeString name;
+    const void *data;
+    int32_t inputIndex;
+    CharString key;  // primary weight bytes only, without terminator
+};
+
+/**
+ * Sets dest to the primary-level bytes of the collator's sort key for s.
+ * They end before the first level separator or the terminator.
+ */
+void getPrimaryKey(const Collator &coll, const UnicodeString &s,
+                   CharString &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    MaybeStackArray<uint8_t, 64> buffer;
+    int32_t length = coll.getSortKey(s, buffer.getAlias(), buffer.getCapacity());
+    if (length > buffer.getCapacity()) {
+        if (buffer.resize(length) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        length = coll.getSortKey(s, buffer.getAlias(), buffer.getCapacity());
+    }
+    int32_t primaryLength = 0;
+    while (primaryLength < length && buffer[primaryLength] > Collation::LEVEL_SEPARATOR_BYTE) {
+        ++primaryLength;
+    }
+    dest.clear().append(reinterpret_cast<const char *>(buffer.getAlias()), primaryLength, errorCode);
+}
+
+}  // namespace
+
+UBool BucketList::computeBoundaryKeys(const Collator &collatorPrimaryOnly, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return FALSE; }
+    int32_t count = bucketList_->size();
+    if (boundaryKeyLimits_.allocateInsteadAndReset(count) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return FALSE;
+    }
+    CharString key;
+    for (int32_t i = 0; i < count; ++i) {
+        getPrimaryKey(collatorPrimaryOnly, getBucket(*bucketList_, i)->lowerBoundary_,
+                      key, errorCode);
+        boundaryKeys_.append(key, errorCode);
+        if (U_FAILURE(errorCode)) { return FALSE; }
+        boundaryKeyLimits_[i] = boundaryKeys_.length();
+        if (key.length() > maxBoundaryKeyLength_) {
+            maxBoundaryKeyLength_ = key.length();
+        }
+    }
+    return TRUE;
+}
+
+void
+AlphabeticIndex::ImmutableIndex::getBucketIndexes(const UnicodeString *names, int32_t count,
+                                                  int32_t *bucketIndexes,
+                                                  UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) { return; }
+    if (count < 0 || (count > 0 && (names == NULL || bucketIndexes == NULL))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    // The collator is a clone of the AlphabeticIndex's primary-only RuleBasedCollator.
+    const RuleBasedCollator &coll = *static_cast<const RuleBasedCollator *>(collatorPrimaryOnly_);
+    // A name's key prefix one byte longer than the longest boundary key
+    // compares with every boundary key like the full key.
+    int32_t capacity = buckets_->getMaxBoundaryKeyLength() + 1;
+    MaybeStackArray<uint8_t, 64> key;
+    if (capacity > key.getCapacity() && key.resize(capacity) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        const UnicodeString &name = names[i];
+        int32_t length = coll.getTruncatedSortKey(name.getBuffer(), name.length(), UCOL_PRIMARY,
+                                                  key.getAlias(), capacity, errorCode);
+        if (U_FAILURE(errorCode)) { return; }
+        if (length > 0 && key[length - 1] == 0) {
+            --length;  // Remove the terminator of a complete key.
+        }
+        bucketIndexes[i] = buckets_->getBucketIndex(
+            reinterpret_cast<const char *>(key.getAlias()), length);
+    }
+}
+
+namespace {
+
+/**
+ * Compares the record key with the prefix key,
+ * ignoring record key bytes beyond the length of the prefix key.
+ */
+int32_t comparePrimaryKeyPrefix(const CharString &key, const CharString &prefix) {
+    int32_t length = key.length() < prefix.length() ? key.length() : prefix.length();
+    int32_t diff = uprv_memcmp(key.data(), prefix.data(), length);
+    if (diff != 0) { return diff; }
+    return key.length() < prefix.length() ? -1 : 0;
+}
+
+/**
+ * Returns the first record whose key compares (when upper) greater than
+ * or (when !upper) greater than or equal to the prefix key.
+ */
+int32_t findPrimaryKeyPrefix(const UVector &records, int32_t start, int32_t limit,
+                             const CharString &prefix, UBool upper) {
+    while (start < limit) {
+        int32_t middle = (start + limit) / 2;
+        const PrefixRecord *r = static_cast<const PrefixRecord *>(records[middle]);
+        int32_t cmp = comparePrimaryKeyPrefix(r->key, prefix);
+        if (cmp < 0 || (upper && cmp == 0)) {
+            start = middle + 1;
+        } else {
+            limit = middle;
+        }
+    }
+    return start;
+}
+
+/**
+ * Appends the [start, limit[ range of records that match the prefix,
+ * if it is not empty.
+ */
+void addPrefixRange(const UVector &records, const Collator &collatorPrimaryOnly,
+                    const UnicodeString &prefix,
+                    MaybeStackArray<int32_t, 8> &ranges, int32_t &rangesLength,
+                    UErrorCode &errorCode) {
+    CharString prefixKey;
+    getPrimaryKey(collatorPrimaryOnly, prefix, prefixKey, errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    int32_t start = findPrimaryKeyPrefix(records, 0, records.size(), prefixKey, FALSE);
+    int32_t limit = findPrimaryKeyPrefix(records, start, records.size(), prefixKey, TRUE);
+    if (start == limit) { return; }
+    if (rangesLength == ranges.getCapacity() &&
+            ranges.resize(2 * rangesLength, rangesLength) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    ranges[rangesLength++] = start;
+    ranges[rangesLength++] = limit;
+}
+
+}  // namespace
+
+static int32_t U_CALLCONV
+prefixRecordCompareFn(const void *context, const void *left, const void *right) {
+    const PrefixRecord *leftRec =
+        static_cast<const PrefixRecord *>(static_cast<const UElement *>(left)->pointer);
+    const PrefixRecord *rightRec =
+        static_cast<const PrefixRecord *>(static_cast<const UElement *>(right)->pointer);
+    int32_t leftLength = leftRec->key.length();
+    int32_t rightLength = rightRec->key.length();
+    int32_t diff = uprv_memcmp(leftRec->key.data(), rightRec->key.data(),
+                               leftLength < rightLength ? leftLength : rightLength);
+    if (diff != 0) {
+        return diff;
+    } else if (leftLength != rightLength) {
+        return leftLength < rightLength ? -1 : 1;
+    }
+    const Collator *col = static_cast<const Collator *>(context);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UCollationResult result = col->compare(leftRec->name, rightRec->name, errorCode);
+    if (result != UCOL_EQUAL) {
+        return result;
+    }
+    if (leftRec->inputIndex == rightRec->inputIndex) {
+        return 0;
+    }
+    return leftRec->inputIndex < rightRec->inputIndex ? -1 : 1;
+}
+
+static void U_CALLCONV
+alphaIndex_deletePrefixRecord(void *obj) {
+    delete static_cast<PrefixRecord *>(obj);
+}
+
+AlphabeticIndex::PrefixIndex::~PrefixIndex() {
+    delete records_;
+    delete collatorPrimaryOnly_;
+    delete contractions_;
+}
+
+int32_t
+AlphabeticIndex::PrefixIndex::getRecordCount() const {
+    return records_->size();
+}
+
+const UnicodeString *
+AlphabeticIndex::PrefixIndex::getRecordName(int32_t index) const {
+    if (0 <= index && index < records_->size()) {
+        return &static_cast<const PrefixRecord *>((*records_)[index])->name;
+    } else {
+        return NULL;
+    }
+}
+
+const void *
+AlphabeticIndex::PrefixIndex::getRecordData(int32_t index) const {
+    if (0 <= index && index < records_->size()) {
+        return static_cast<const PrefixRecord *>((*records_)[index])->data;
+    } else {
+        return NULL;
+    }
+}
+
+int32_t
+AlphabeticIndex::PrefixIndex::getPrefixRanges(const UnicodeString &prefix,
+                                              int32_t *ranges, int32_t capacity,
+                                              UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) { return 0; }
+    if (capacity < 0 || (ranges == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    MaybeStackArray<int32_t, 8> found;
+    int32_t foundLength = 0;
+    addPrefixRange(*records_, *collatorPrimaryOnly_, prefix, found, foundLength, errorCode);
+
+    // If the prefix ends with the beginning of a contraction, then its sort key
+    // differs from that of a name which continues the contraction.
+    // Look up each such completion of the prefix as well.
+    int32_t prefixLength = prefix.length();
+    for (int32_t suffixLength = 1;
+            suffixLength < maxContractionLength_ && suffixLength <= prefixLength;
+            ++suffixLength) {
+        int32_t suffixStart = prefixLength - suffixLength;
+        if (suffixStart > 0 && U16_IS_TRAIL(prefix[suffixStart]) &&
+                U16_IS_LEAD(prefix[suffixStart - 1])) {
+            continue;  // Do not split a surrogate pair.
+        }
+        UnicodeString suffix = prefix.tempSubString(suffixStart);
+        // Binary search for the first contraction that is not less than the suffix.
+        int32_t start = 0;
+        int32_t limit = contractions_->size();
+        while (start < limit) {
+            int32_t middle = (start + limit) / 2;
+            if (getString(*contractions_, middle)->compare(suffix) < 0) {
+                start = middle + 1;
+            } else {
+                limit = middle;
+            }
+        }
+        for (; start < contractions_->size(); ++start) {
+            const UnicodeString &contraction = *getString(*contractions_, start);
+            if (!contraction.startsWith(suffix)) { break; }
+            if (contraction.length() > suffixLength) {
+                UnicodeString completed(prefix);
+                completed.append(contraction, suffixLength, INT32_MAX);
+                addPrefixRange(*records_, *collatorPrimaryOnly_, completed,
+                               found, foundLength, errorCode);
+            }
+        }
+    }
+    if (U_FAILURE(errorCode)) { return 0; }
+
+    // Sort the ranges by their start indexes (there are few), then merge overlapping ones.
+    for (int32_t i = 2; i < foundLength; i += 2) {
+        int32_t start = found[i];
+        int32_t limit = found[i + 1];
+        int32_t j = i;
+        for (; j > 0 && found[j - 2] > start; j -= 2) {
+            found[j] = found[j - 2];
+            found[j + 1] = found[j - 1];
+        }
+        found[j] = start;
+        found[j + 1] = limit;
+    }
+    int32_t count = 0;
+    int32_t lastLimit = -1;
+    for (int32_t i = 0; i < foundLength; i += 2) {
+        if (found[i] <= lastLimit) {
+            // Extend the previous range.
+            if (found[i + 1] > lastLimit) {
+                lastLimit = found[i + 1];
+                if (count <= capacity) {
+                    ranges[2 * count - 1] = lastLimit;
+                }
+            }
+        } else {
+            if (count < capacity) {
+                ranges[2 * count] = found[i];
+                ranges[2 * count + 1] = found[i + 1];
+            }
+            ++count;
+            lastLimit = found[i + 1];
+        }
+    }
+    if (count > capacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 AlphabeticIndex::AlphabeticIndex(const Locale &locale, UErrorCode &status)
         : inputList_(NULL),
           labelsIterIndex_(-1), itemsIterIndex_(0), currentBucket_(NULL),
@@ -264,6 +607,7 @@ AlphabeticIndex::ImmutableIndex *AlphabeticIndex::buildImmutableIndex(UErrorCode
         errorCode = U_MEMORY_ALLOCATION_ERROR;
         return NULL;
     }
+    if (!immutableBucketList->computeBoundaryKeys(*coll, errorCode)) { return NULL; }
     ImmutableIndex *immIndex = new ImmutableIndex(immutableBucketList.getAlias(), coll.getAlias());
     if (immIndex == NULL) {
         errorCode = U_MEMORY_ALLOCATION_ERROR;
@@ -275,6 +619,66 @@ AlphabeticIndex::ImmutableIndex *AlphabeticIndex::buildImmutableIndex(UErrorCode
     return immIndex;
 }
 
+AlphabeticIndex::PrefixIndex *AlphabeticIndex::buildPrefixIndex(UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return NULL; }
+    LocalPointer<UVector> records(new UVector(errorCode), errorCode);
+    if (U_FAILURE(errorCode)) { return NULL; }
+    records->setDeleter(alphaIndex_deletePrefixRecord);
+    int32_t recordCount = inputList_ != NULL ? inputList_->size() : 0;
+    for (int32_t i = 0; i < recordCount; ++i) {
+        const Record *r = getRecord(*inputList_, i);
+        PrefixRecord *pr = new PrefixRecord(r->name_, r->data_, i);
+        if (pr == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        records->addElement(pr, errorCode);
+        if (U_FAILURE(errorCode)) {
+            delete pr;
+            return NULL;
+        }
+        getPrimaryKey(*collatorPrimaryOnly_, pr->name, pr->key, errorCode);
+    }
+    records->sortWithUComparator(prefixRecordCompareFn, collator_, errorCode);
+
+    // Contractions in code unit order, as iterated from a UnicodeSet.
+    UnicodeSet contractionSet;
+    collatorPrimaryOnly_->internalGetContractionsAndExpansions(
+        &contractionSet, NULL, FALSE, errorCode);
+    LocalPointer<UVector> contractions(new UVector(errorCode), errorCode);
+    if (U_FAILURE(errorCode)) { return NULL; }
+    contractions->setDeleter(uprv_deleteUObject);
+    int32_t maxContractionLength = 0;
+    UnicodeSetIterator iter(contractionSet);
+    while (iter.next()) {
+        if (!iter.isString()) { continue; }
+        const UnicodeString &contraction = iter.getString();
+        LocalPointer<UnicodeString> owned;
+        contractions->addElement(ownedString(contraction, owned, errorCode), errorCode);
+        if (U_FAILURE(errorCode)) { return NULL; }
+        if (contraction.length() > maxContractionLength) {
+            maxContractionLength = contraction.length();
+        }
+    }
+
+    LocalPointer<Collator> coll(collatorPrimaryOnly_->clone());
+    if (coll.isNull()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    PrefixIndex *prefixIndex = new PrefixIndex(
+        records.getAlias(), coll.getAlias(), contractions.getAlias(), maxContractionLength);
+    if (prefixIndex == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    // The PrefixIndex adopted its parameter objects.
+    records.orphan();
+    coll.orphan();
+    contractions.orphan();
+    return prefixIndex;
+}
+
 int32_t AlphabeticIndex::getBucketCount(UErrorCode &status) {
     initBuckets(status);
     if (U_FAILURE(status)) {
@@ -26,6 +26,7 @@
 #include "unicode/uchar.h"
 #include "unicode/ucol.h"
 #include "unicode/unistr.h"
+#include "unicode/putil.h"
 #include "unicode/usetiter.h"
 #include "unicode/utf16.h"
 #include "unicode/uversion.h"
@@ -44,6 +45,8 @@
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ucol_imp.h"
+#include "uinvchar.h"
+#include "unifiedcache.h"
 #include "utf16collationiterator.h"
 
 U_NAMESPACE_BEGIN
@@ -70,6 +73,101 @@ BundleImporter::getRules(
     CollationLoader::loadRules(localeID, collationType, rules, errorCode);
 }
 
+CollationTailoring *
+buildTailoring(const UnicodeString &rules,
+               UParseError *outParseError, UnicodeString *outReason,
+               UErrorCode &errorCode) {
+    const CollationTailoring *base = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    CollationBuilder builder(base, errorCode);
+    UVersionInfo noVersion = { 0, 0, 0, 0 };
+    BundleImporter importer;
+    LocalPointer<CollationTailoring> t(builder.parseAndBuild(rules, noVersion,
+                                                             &importer,
+                                                             outParseError, errorCode));
+    if(U_FAILURE(errorCode)) {
+        const char *reason = builder.getErrorReason();
+        if(reason != NULL && outReason != NULL) {
+            *outReason = UnicodeString(reason, -1, US_INV);
+        }
+        return NULL;
+    }
+    t->actualLocale.setToBogus();
+    return t.orphan();
+}
+
+/**
+ * Cache key for a tailoring built from a rule string.
+ * Identical rule strings are parsed and built only once per process
+ * (until the cache evicts the unused tailoring).
+ */
+class CollationRulesCacheKey : public CacheKey<CollationCacheEntry> {
+public:
+    // Copy the characters: The rules may be a read-only alias
+    // of a buffer that does not outlive the cache entry.
+    CollationRulesCacheKey(const UnicodeString &r) : rules(r.getBuffer(), r.length()) {}
+    CollationRulesCacheKey(const CollationRulesCacheKey &other)
+            : CacheKey<CollationCacheEntry>(other), rules(other.rules) {}
+    virtual ~CollationRulesCacheKey();
+    virtual int32_t hashCode() const {
+        return 37 * CacheKey<CollationCacheEntry>::hashCode() + rules.hashCode();
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if(this == &other) { return TRUE; }
+        if(!CacheKey<CollationCacheEntry>::operator==(other)) { return FALSE; }
+        return rules == static_cast<const CollationRulesCacheKey &>(other).rules;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new CollationRulesCacheKey(*this);
+    }
+    virtual const SharedObject *createObject(const void *creationContext,
+                                             UErrorCode &errorCode) const;
+    virtual char *writeDescription(char *buffer, int32_t bufLen) const;
+private:
+    UnicodeString rules;
+};
+
+CollationRulesCacheKey::~CollationRulesCacheKey() {}
+
+char *
+CollationRulesCacheKey::writeDescription(char *buffer, int32_t bufLen) const {
+    // Write as much of the rules as fits.
+    // Rules usually contain variant characters like '[' and '@': Escape those as \uhhhh.
+    static const char hexDigits[] = "0123456789ABCDEF";
+    int32_t length = 0;
+    for(int32_t i = 0; i < rules.length(); ++i) {
+        UChar c = rules.charAt(i);
+        if(uprv_isInvariantUString(&c, 1)) {
+            if((length + 1) >= bufLen) { break; }
+            u_UCharsToChars(&c, buffer + length++, 1);
+        } else {
+            if((length + 6) >= bufLen) { break; }
+            buffer[length++] = '\\';
+            buffer[length++] = 'u';
+            for(int32_t shift = 12; shift >= 0; shift -= 4) {
+                buffer[length++] = hexDigits[(c >> shift) & 0xf];
+            }
+        }
+    }
+    buffer[length] = 0;
+    return buffer;
+}
+
+const SharedObject *
+CollationRulesCacheKey::createObject(const void * /*creationContext*/,
+                                     UErrorCode &errorCode) const {
+    CollationTailoring *t = buildTailoring(rules, NULL, NULL, errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    CollationCacheEntry *entry = new CollationCacheEntry(t->actualLocale, t);
+    if(entry == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        t->deleteIfZeroRefCount();
+        return NULL;
+    }
+    entry->addRef();
+    return entry;
+}
+
 }  // namespace
 
 // RuleBasedCollator implementation ---------------------------------------- ***
@@ -159,24 +257,32 @@ RuleBasedCollator::internalBuildTailoring(const UnicodeString &rules,
                                           UColAttributeValue decompositionMode,
                                           UParseError *outParseError, UnicodeString *outReason,
                                           UErrorCode &errorCode) {
-    const CollationTailoring *base = CollationRoot::getRoot(errorCode);
     if(U_FAILURE(errorCode)) { return; }
     if(outReason != NULL) { outReason->remove(); }
-    CollationBuilder builder(base, errorCode);
-    UVersionInfo noVersion = { 0, 0, 0, 0 };
-    BundleImporter importer;
-    LocalPointer<CollationTailoring> t(builder.parseAndBuild(rules, noVersion,
-                                                             &importer,
-                                                             outParseError, errorCode));
+    const UnifiedCache *cache = UnifiedCache::getInstance(errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    const CollationCacheEntry *entry = NULL;
+    cache->get(CollationRulesCacheKey(rules), entry, errorCode);
     if(U_FAILURE(errorCode)) {
-        const char *reason = builder.getErrorReason();
-        if(reason != NULL && outReason != NULL) {
-            *outReason = UnicodeString(reason, -1, US_INV);
+        if(outParseError != NULL || outReason != NULL) {
+            // The cache does not keep the error details. Build again to get them.
+            errorCode = U_ZERO_ERROR;
+            CollationTailoring *t = buildTailoring(rules, outParseError, outReason, errorCode);
+            if(U_SUCCESS(errorCode)) {
+                // The cached failure was not a rules error, e.g., out of memory.
+                adoptTailoring(t, errorCode);
+            }
         }
         return;
     }
-    t->actualLocale.setToBogus();
-    adoptTailoring(t.orphan(), errorCode);
+    // Same as the RuleBasedCollator(const CollationCacheEntry *) constructor,
+    // except that get() already added the reference to the entry.
+    data = entry->tailoring->data;
+    settings = entry->tailoring->settings;
+    settings->addRef();
+    tailoring = entry->tailoring;
+    cacheEntry = entry;
+    validLocale = entry->validLocale;
     // Set attributes after building the collator,
     // to keep the default settings consistent with the rule string.
     if(strength != UCOL_DEFAULT) {
@@ -16,6 +16,7 @@
 #include "unicode/ucol.h"
 #include "unicode/udata.h"
 #include "unicode/uscript.h"
+#include "unicode/uversion.h"
 #include "cmemory.h"
 #include "collation.h"
 #include "collationdata.h"
@@ -26,6 +27,7 @@
 #include "collationsettings.h"
 #include "collationtailoring.h"
 #include "collunsafe.h"
+#include "cstring.h"
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ucmndata.h"
@@ -39,6 +41,34 @@ int32_t getIndex(const int32_t *indexes, int32_t length, int32_t i) {
     return (i < length) ? indexes[i] : -1;
 }
 
+/**
+ * Returns the root collator's unsafe-backward set from the frozen image
+ * precomputed by gencolusb, or NULL if there is none that fits this data.
+ * The image's inversion list is used in place: It is shared read-only data,
+ * not rebuilt in each process.
+ */
+UnicodeSet *openPrecomputedRootUnsafeBackwardSet(const UVersionInfo version) {
+#if defined(COLLUNSAFE_COLL_VERSION) && defined(COLLUNSAFE_FROZEN)
+    char versionString[U_MAX_VERSION_STRING_LENGTH];
+    u_versionToString(version, versionString);
+    if(uprv_strcmp(versionString, COLLUNSAFE_COLL_VERSION) != 0) {
+        return NULL;  // different root collation data
+    }
+    // Fails for a different endianness or charset family than where it was generated.
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UnicodeSet *set = UnicodeSet::createFrozenFromSerialized(
+        unsafe_frozenData, unsafe_frozenCount * 4, errorCode);
+    if(U_FAILURE(errorCode)) {
+        delete set;
+        return NULL;
+    }
+    return set;
+#else
+    (void)version;
+    return NULL;
+#endif
+}
+
 }  // namespace
 
 void
@@ -257,13 +287,20 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
     index = IX_UNSAFE_BWD_OFFSET;
     offset = getIndex(inIndexes, indexesLength, index);
     length = getIndex(inIndexes, indexesLength, index + 1) - offset;
-    if(length >= 2) {
+    if(length >= 2 && data != NULL && baseData == NULL) {
+        tailoring.unsafeBackwardSet = openPrecomputedRootUnsafeBackwardSet(tailoring.version);
+    }
+    if(tailoring.unsafeBackwardSet != NULL) {
+        // The precomputed root set already contains the ranges from the data file.
+        data->unsafeBackwardSet = tailoring.unsafeBackwardSet;
+    } else if(length >= 2) {
         if(data == NULL) {
             errorCode = U_INVALID_FORMAT_ERROR;
             return;
         }
         if(baseData == NULL) {
 #if defined(COLLUNSAFE_COLL_VERSION) && defined (COLLUNSAFE_SERIALIZE)
+          // The frozen image did not fit this platform or data: Use the portable serialized set.
           tailoring.unsafeBackwardSet = new UnicodeSet(unsafe_serializedData, unsafe_serializedCount, UnicodeSet::kSerialized, errorCode);
           if(tailoring.unsafeBackwardSet == NULL) {
             errorCode = U_MEMORY_ALLOCATION_ERROR;
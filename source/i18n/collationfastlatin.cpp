@@ -104,9 +104,64 @@ CollationFastLatin::getOptions(const CollationData *data, const CollationSetting
 }
 
 int32_t
-CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primaries, int32_t options,
-                                 const UChar *left, int32_t leftLength,
-                                 const UChar *right, int32_t rightLength) {
+CollationFastLatin::getScriptOptions(const CollationData *data, const CollationSettings &settings,
+                                     const uint16_t *table, int32_t scriptTableIndex) {
+    if(table == NULL) { return -1; }
+    // The fast script tables do not handle numeric collation of the script's own digits.
+    if((settings.options & CollationSettings::NUMERIC) != 0) { return -1; }
+
+    uint32_t miniVarTop;
+    if((settings.options & CollationSettings::ALTERNATE_MASK) == 0) {
+        miniVarTop = MIN_LONG - 1;
+    } else {
+        int32_t headerLength = *table & 0xff;
+        int32_t i = 1 + settings.getMaxVariable();
+        if(i >= headerLength) {
+            return -1;  // variableTop >= digits, should not occur
+        }
+        miniVarTop = table[i];
+    }
+
+    if(settings.hasReordering()) {
+        // The special groups, digits and the script must remain in this order.
+        uint32_t prevStart = 0;
+        for(int32_t group = UCOL_REORDER_CODE_FIRST;; ++group) {
+            uint32_t start;
+            if(group <= UCOL_REORDER_CODE_DIGIT) {
+                start = data->getFirstPrimaryForGroup(group);
+            } else {
+                start = data->getFirstPrimaryForGroup(getScriptCode(scriptTableIndex));
+            }
+            if(start != 0) {
+                start = settings.reorder(start);
+                if(start <= prevStart) { return -1; }
+                prevStart = start;
+            }
+            if(group > UCOL_REORDER_CODE_DIGIT) { break; }
+        }
+    }
+
+    return ((int32_t)miniVarTop << 16) | settings.options;
+}
+
+template<UBool isLatin>
+inline uint32_t
+CollationFastLatin::lookupSupported(const uint16_t *table, UChar32 blockStart, UChar32 c) {
+    if(isLatin ? c <= LATIN_MAX : c <= 0x7f) {
+        return table[c];
+    } else if(!isLatin && (uint32_t)(c - blockStart) < SCRIPT_BLOCK_LENGTH) {
+        return table[c - blockStart + 0x80];
+    } else {
+        return lookup(table, c);
+    }
+}
+
+template<UBool isLatin>
+int32_t
+CollationFastLatin::doCompareUTF16(const uint16_t *table, const uint16_t *primaries, int32_t options,
+                                   UChar32 blockStart,
+                                   const UChar *left, int32_t leftLength,
+                                   const UChar *right, int32_t rightLength) {
     // This is a modified copy of CollationCompare::compareUpToQuaternary(),
     // optimized for common Latin text.
     // Keep them in sync!
@@ -133,13 +188,17 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = left[leftIndex++];
-            if(c <= LATIN_MAX) {
-                leftPair = primaries[c];
-                if(leftPair != 0) { break; }
-                if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
-                    return BAIL_OUT_RESULT;
+            if(isLatin ? c <= LATIN_MAX : c <= 0x7f) {
+                if(isLatin) {
+                    leftPair = primaries[c];
+                    if(leftPair != 0) { break; }
+                    if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
+                        return BAIL_OUT_RESULT;
+                    }
                 }
                 leftPair = table[c];
+            } else if(!isLatin && (uint32_t)(c - blockStart) < SCRIPT_BLOCK_LENGTH) {
+                leftPair = table[c - blockStart + 0x80];
             } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                 leftPair = table[c - PUNCT_START + LATIN_LIMIT];
             } else {
@@ -152,7 +211,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 leftPair &= LONG_PRIMARY_MASK;
                 break;
             } else {
-                leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
+                leftPair = nextPair(table, c, leftPair, blockStart, left, NULL, leftIndex, leftLength);
                 if(leftPair == BAIL_OUT) { return BAIL_OUT_RESULT; }
                 leftPair = getPrimaries(variableTop, leftPair);
             }
@@ -164,13 +223,17 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = right[rightIndex++];
-            if(c <= LATIN_MAX) {
-                rightPair = primaries[c];
-                if(rightPair != 0) { break; }
-                if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
-                    return BAIL_OUT_RESULT;
+            if(isLatin ? c <= LATIN_MAX : c <= 0x7f) {
+                if(isLatin) {
+                    rightPair = primaries[c];
+                    if(rightPair != 0) { break; }
+                    if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
+                        return BAIL_OUT_RESULT;
+                    }
                 }
                 rightPair = table[c];
+            } else if(!isLatin && (uint32_t)(c - blockStart) < SCRIPT_BLOCK_LENGTH) {
+                rightPair = table[c - blockStart + 0x80];
             } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                 rightPair = table[c - PUNCT_START + LATIN_LIMIT];
             } else {
@@ -183,7 +246,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 rightPair &= LONG_PRIMARY_MASK;
                 break;
             } else {
-                rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
+                rightPair = nextPair(table, c, rightPair, blockStart, right, NULL, rightIndex, rightLength);
                 if(rightPair == BAIL_OUT) { return BAIL_OUT_RESULT; }
                 rightPair = getPrimaries(variableTop, rightPair);
             }
@@ -220,8 +283,10 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     break;
                 }
                 UChar32 c = left[leftIndex++];
-                if(c <= LATIN_MAX) {
+                if(isLatin ? c <= LATIN_MAX : c <= 0x7f) {
                     leftPair = table[c];
+                } else if(!isLatin && (uint32_t)(c - blockStart) < SCRIPT_BLOCK_LENGTH) {
+                    leftPair = table[c - blockStart + 0x80];
                 } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                     leftPair = table[c - PUNCT_START + LATIN_LIMIT];
                 } else {
@@ -234,7 +299,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     leftPair = COMMON_SEC_PLUS_OFFSET;
                     break;
                 } else {
-                    leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
+                    leftPair = nextPair(table, c, leftPair, blockStart, left, NULL, leftIndex, leftLength);
                     leftPair = getSecondaries(variableTop, leftPair);
                 }
             }
@@ -245,8 +310,10 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     break;
                 }
                 UChar32 c = right[rightIndex++];
-                if(c <= LATIN_MAX) {
+                if(isLatin ? c <= LATIN_MAX : c <= 0x7f) {
                     rightPair = table[c];
+                } else if(!isLatin && (uint32_t)(c - blockStart) < SCRIPT_BLOCK_LENGTH) {
+                    rightPair = table[c - blockStart + 0x80];
                 } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                     rightPair = table[c - PUNCT_START + LATIN_LIMIT];
                 } else {
@@ -259,7 +326,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     rightPair = COMMON_SEC_PLUS_OFFSET;
                     break;
                 } else {
-                    rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
+                    rightPair = nextPair(table, c, rightPair, blockStart, right, NULL, rightIndex, rightLength);
                     rightPair = getSecondaries(variableTop, rightPair);
                 }
             }
@@ -296,9 +363,9 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     break;
                 }
                 UChar32 c = left[leftIndex++];
-                leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+                leftPair = lookupSupported<isLatin>(table, blockStart, c);
                 if(leftPair < MIN_LONG) {
-                    leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
+                    leftPair = nextPair(table, c, leftPair, blockStart, left, NULL, leftIndex, leftLength);
                 }
                 leftPair = getCases(variableTop, strengthIsPrimary, leftPair);
             }
@@ -309,9 +376,9 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     break;
                 }
                 UChar32 c = right[rightIndex++];
-                rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+                rightPair = lookupSupported<isLatin>(table, blockStart, c);
                 if(rightPair < MIN_LONG) {
-                    rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
+                    rightPair = nextPair(table, c, rightPair, blockStart, right, NULL, rightIndex, rightLength);
                 }
                 rightPair = getCases(variableTop, strengthIsPrimary, rightPair);
             }
@@ -349,9 +416,9 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            leftPair = lookupSupported<isLatin>(table, blockStart, c);
             if(leftPair < MIN_LONG) {
-                leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
+                leftPair = nextPair(table, c, leftPair, blockStart, left, NULL, leftIndex, leftLength);
             }
             leftPair = getTertiaries(variableTop, withCaseBits, leftPair);
         }
@@ -362,9 +429,9 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            rightPair = lookupSupported<isLatin>(table, blockStart, c);
             if(rightPair < MIN_LONG) {
-                rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
+                rightPair = nextPair(table, c, rightPair, blockStart, right, NULL, rightIndex, rightLength);
             }
             rightPair = getTertiaries(variableTop, withCaseBits, rightPair);
         }
@@ -405,9 +472,9 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            leftPair = lookupSupported<isLatin>(table, blockStart, c);
             if(leftPair < MIN_LONG) {
-                leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
+                leftPair = nextPair(table, c, leftPair, blockStart, left, NULL, leftIndex, leftLength);
             }
             leftPair = getQuaternaries(variableTop, leftPair);
         }
@@ -418,9 +485,9 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            rightPair = lookupSupported<isLatin>(table, blockStart, c);
             if(rightPair < MIN_LONG) {
-                rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
+                rightPair = nextPair(table, c, rightPair, blockStart, right, NULL, rightIndex, rightLength);
             }
             rightPair = getQuaternaries(variableTop, rightPair);
         }
@@ -442,16 +509,20 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
     return UCOL_EQUAL;
 }
 
+template<UBool isLatin>
 int32_t
-CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries, int32_t options,
-                                 const uint8_t *left, int32_t leftLength,
-                                 const uint8_t *right, int32_t rightLength) {
+CollationFastLatin::doCompareUTF8(const uint16_t *table, const uint16_t *primaries, int32_t options,
+                                  UChar32 blockStart,
+                                  const uint8_t *left, int32_t leftLength,
+                                  const uint8_t *right, int32_t rightLength) {
     // Keep compareUTF16() and compareUTF8() in sync very closely!
 
     U_ASSERT((table[0] >> 8) == VERSION);
     table += (table[0] & 0xff);  // skip the header
     uint32_t variableTop = (uint32_t)options >> 16;  // see RuleBasedCollator::getFastLatinOptions()
     options &= 0xffff;  // needed for CollationSettings::getStrength() to work
+    // The block starts at a UTF-8 lead byte boundary: U+0080 -> C2, U+0400 -> D0 etc.
+    UChar32 leadStart = isLatin ? 0xc2 : 0xc0 + (blockStart >> 6);
 
     // Check for supported characters, fetch mini CEs, and compare primaries.
     int32_t leftIndex = 0, rightIndex = 0;
@@ -474,18 +545,22 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
             UChar32 c = left[leftIndex++];
             uint8_t t;
             if(c <= 0x7f) {
-                leftPair = primaries[c];
-                if(leftPair != 0) { break; }
-                if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
-                    return BAIL_OUT_RESULT;
+                if(isLatin) {
+                    leftPair = primaries[c];
+                    if(leftPair != 0) { break; }
+                    if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
+                        return BAIL_OUT_RESULT;
+                    }
                 }
                 leftPair = table[c];
-            } else if(c <= LATIN_MAX_UTF8_LEAD && 0xc2 <= c && leftIndex != leftLength &&
+            } else if((uint32_t)(c - leadStart) <= 3 && leftIndex != leftLength &&
                     0x80 <= (t = left[leftIndex]) && t <= 0xbf) {
                 ++leftIndex;
-                c = ((c - 0xc2) << 6) + t;
-                leftPair = primaries[c];
-                if(leftPair != 0) { break; }
+                c = ((c - leadStart) << 6) + t;
+                if(isLatin) {
+                    leftPair = primaries[c];
+                    if(leftPair != 0) { break; }
+                }
                 leftPair = table[c];
             } else {
                 leftPair = lookupUTF8(table, c, left, leftIndex, leftLength);
@@ -497,7 +572,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 leftPair &= LONG_PRIMARY_MASK;
                 break;
             } else {
-                leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
+                leftPair = nextPair(table, c, leftPair, blockStart, NULL, left, leftIndex, leftLength);
                 if(leftPair == BAIL_OUT) { return BAIL_OUT_RESULT; }
                 leftPair = getPrimaries(variableTop, leftPair);
             }
@@ -511,18 +586,22 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
             UChar32 c = right[rightIndex++];
             uint8_t t;
             if(c <= 0x7f) {
-                rightPair = primaries[c];
-                if(rightPair != 0) { break; }
-                if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
-                    return BAIL_OUT_RESULT;
+                if(isLatin) {
+                    rightPair = primaries[c];
+                    if(rightPair != 0) { break; }
+                    if(c <= 0x39 && c >= 0x30 && (options & CollationSettings::NUMERIC) != 0) {
+                        return BAIL_OUT_RESULT;
+                    }
                 }
                 rightPair = table[c];
-            } else if(c <= LATIN_MAX_UTF8_LEAD && 0xc2 <= c && rightIndex != rightLength &&
+            } else if((uint32_t)(c - leadStart) <= 3 && rightIndex != rightLength &&
                     0x80 <= (t = right[rightIndex]) && t <= 0xbf) {
                 ++rightIndex;
-                c = ((c - 0xc2) << 6) + t;
-                rightPair = primaries[c];
-                if(rightPair != 0) { break; }
+                c = ((c - leadStart) << 6) + t;
+                if(isLatin) {
+                    rightPair = primaries[c];
+                    if(rightPair != 0) { break; }
+                }
                 rightPair = table[c];
             } else {
                 rightPair = lookupUTF8(table, c, right, rightIndex, rightLength);
@@ -534,7 +613,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 rightPair &= LONG_PRIMARY_MASK;
                 break;
             } else {
-                rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
+                rightPair = nextPair(table, c, rightPair, blockStart, NULL, right, rightIndex, rightLength);
                 if(rightPair == BAIL_OUT) { return BAIL_OUT_RESULT; }
                 rightPair = getPrimaries(variableTop, rightPair);
             }
@@ -573,10 +652,10 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 UChar32 c = left[leftIndex++];
                 if(c <= 0x7f) {
                     leftPair = table[c];
-                } else if(c <= LATIN_MAX_UTF8_LEAD) {
-                    leftPair = table[((c - 0xc2) << 6) + left[leftIndex++]];
+                } else if((uint32_t)(c - leadStart) <= 3) {
+                    leftPair = table[((c - leadStart) << 6) + left[leftIndex++]];
                 } else {
-                    leftPair = lookupUTF8Unsafe(table, c, left, leftIndex);
+                    leftPair = lookupUTF8Unsafe(table, c, blockStart, left, leftIndex);
                 }
                 if(leftPair >= MIN_SHORT) {
                     leftPair = getSecondariesFromOneShortCE(leftPair);
@@ -585,7 +664,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                     leftPair = COMMON_SEC_PLUS_OFFSET;
                     break;
                 } else {
-                    leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
+                    leftPair = nextPair(table, c, leftPair, blockStart, NULL, left, leftIndex, leftLength);
                     leftPair = getSecondaries(variableTop, leftPair);
                 }
             }
@@ -598,10 +677,10 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 UChar32 c = right[rightIndex++];
                 if(c <= 0x7f) {
                     rightPair = table[c];
-                } else if(c <= LATIN_MAX_UTF8_LEAD) {
-                    rightPair = table[((c - 0xc2) << 6) + right[rightIndex++]];
+                } else if((uint32_t)(c - leadStart) <= 3) {
+                    rightPair = table[((c - leadStart) << 6) + right[rightIndex++]];
                 } else {
-                    rightPair = lookupUTF8Unsafe(table, c, right, rightIndex);
+                    rightPair = lookupUTF8Unsafe(table, c, blockStart, right, rightIndex);
                 }
                 if(rightPair >= MIN_SHORT) {
                     rightPair = getSecondariesFromOneShortCE(rightPair);
@@ -610,7 +689,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                     rightPair = COMMON_SEC_PLUS_OFFSET;
                     break;
                 } else {
-                    rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
+                    rightPair = nextPair(table, c, rightPair, blockStart, NULL, right, rightIndex, rightLength);
                     rightPair = getSecondaries(variableTop, rightPair);
                 }
             }
@@ -647,9 +726,9 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                     break;
                 }
                 UChar32 c = left[leftIndex++];
-                leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, left, leftIndex);
+                leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, blockStart, left, leftIndex);
                 if(leftPair < MIN_LONG) {
-                    leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
+                    leftPair = nextPair(table, c, leftPair, blockStart, NULL, left, leftIndex, leftLength);
                 }
                 leftPair = getCases(variableTop, strengthIsPrimary, leftPair);
             }
@@ -660,9 +739,9 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                     break;
                 }
                 UChar32 c = right[rightIndex++];
-                rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, right, rightIndex);
+                rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, blockStart, right, rightIndex);
                 if(rightPair < MIN_LONG) {
-                    rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
+                    rightPair = nextPair(table, c, rightPair, blockStart, NULL, right, rightIndex, rightLength);
                 }
                 rightPair = getCases(variableTop, strengthIsPrimary, rightPair);
             }
@@ -700,9 +779,9 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, left, leftIndex);
+            leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, blockStart, left, leftIndex);
             if(leftPair < MIN_LONG) {
-                leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
+                leftPair = nextPair(table, c, leftPair, blockStart, NULL, left, leftIndex, leftLength);
             }
             leftPair = getTertiaries(variableTop, withCaseBits, leftPair);
         }
@@ -713,9 +792,9 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, right, rightIndex);
+            rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, blockStart, right, rightIndex);
             if(rightPair < MIN_LONG) {
-                rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
+                rightPair = nextPair(table, c, rightPair, blockStart, NULL, right, rightIndex, rightLength);
             }
             rightPair = getTertiaries(variableTop, withCaseBits, rightPair);
         }
@@ -756,9 +835,9 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, left, leftIndex);
+            leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, blockStart, left, leftIndex);
             if(leftPair < MIN_LONG) {
-                leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
+                leftPair = nextPair(table, c, leftPair, blockStart, NULL, left, leftIndex, leftLength);
             }
             leftPair = getQuaternaries(variableTop, leftPair);
         }
@@ -769,9 +848,9 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, right, rightIndex);
+            rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, blockStart, right, rightIndex);
             if(rightPair < MIN_LONG) {
-                rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
+                rightPair = nextPair(table, c, rightPair, blockStart, NULL, right, rightIndex, rightLength);
             }
             rightPair = getQuaternaries(variableTop, rightPair);
         }
@@ -793,9 +872,44 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
     return UCOL_EQUAL;
 }
 
+int32_t
+CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primaries, int32_t options,
+                                 const UChar *left, int32_t leftLength,
+                                 const UChar *right, int32_t rightLength) {
+    return doCompareUTF16<TRUE>(table, primaries, options, 0x80,
+                                left, leftLength, right, rightLength);
+}
+
+int32_t
+CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries, int32_t options,
+                                 const uint8_t *left, int32_t leftLength,
+                                 const uint8_t *right, int32_t rightLength) {
+    return doCompareUTF8<TRUE>(table, primaries, options, 0x80,
+                               left, leftLength, right, rightLength);
+}
+
+int32_t
+CollationFastLatin::compareScriptUTF16(const uint16_t *table, int32_t options,
+                                       int32_t scriptTableIndex,
+                                       const UChar *left, int32_t leftLength,
+                                       const UChar *right, int32_t rightLength) {
+    return doCompareUTF16<FALSE>(table, NULL, options, getScriptBlockStart(scriptTableIndex),
+                                 left, leftLength, right, rightLength);
+}
+
+int32_t
+CollationFastLatin::compareScriptUTF8(const uint16_t *table, int32_t options,
+                                      int32_t scriptTableIndex,
+                                      const uint8_t *left, int32_t leftLength,
+                                      const uint8_t *right, int32_t rightLength) {
+    return doCompareUTF8<FALSE>(table, NULL, options, getScriptBlockStart(scriptTableIndex),
+                                left, leftLength, right, rightLength);
+}
+
 uint32_t
 CollationFastLatin::lookup(const uint16_t *table, UChar32 c) {
-    U_ASSERT(c > LATIN_MAX);
+    // The caller handled ASCII and the table's block.
+    U_ASSERT(c > 0x7f);
     if(PUNCT_START <= c && c < PUNCT_LIMIT) {
         return table[c - PUNCT_START + LATIN_LIMIT];
     } else if(c == 0xfffe) {
@@ -831,13 +945,14 @@ CollationFastLatin::lookupUTF8(const uint16_t *table, UChar32 c,
 }
 
 uint32_t
-CollationFastLatin::lookupUTF8Unsafe(const uint16_t *table, UChar32 c,
+CollationFastLatin::lookupUTF8Unsafe(const uint16_t *table, UChar32 c, UChar32 blockStart,
                                      const uint8_t *s8, int32_t &sIndex) {
     // The caller handled ASCII.
     // The string is well-formed and contains only supported characters.
     U_ASSERT(c > 0x7f);
-    if(c <= LATIN_MAX_UTF8_LEAD) {
-        return table[((c - 0xc2) << 6) + s8[sIndex++]];  // 0080..017F
+    if(c < 0xe0) {
+        // 0080..017F, or the script block
+        return table[((c - (0xc0 + (blockStart >> 6))) << 6) + s8[sIndex++]];
     }
     uint8_t t2 = s8[sIndex + 1];
     sIndex += 2;
@@ -851,7 +966,7 @@ CollationFastLatin::lookupUTF8Unsafe(const uint16_t *table, UChar32 c,
 }
 
 uint32_t
-CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
+CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce, UChar32 blockStart,
                              const UChar *s16, const uint8_t *s8, int32_t &sIndex, int32_t &sLength) {
     if(ce >= MIN_LONG || ce < CONTRACTION) {
         return ce;  // simple or special mini CE
@@ -872,8 +987,10 @@ CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
             int32_t nextIndex = sIndex;
             if(s16 != NULL) {
                 c2 = s16[nextIndex++];
-                if(c2 > LATIN_MAX) {
-                    if(PUNCT_START <= c2 && c2 < PUNCT_LIMIT) {
+                if(c2 > 0x7f) {
+                    if((uint32_t)(c2 - blockStart) < SCRIPT_BLOCK_LENGTH) {
+                        c2 = c2 - blockStart + 0x80;  // 0080..017F, or the script block
+                    } else if(PUNCT_START <= c2 && c2 < PUNCT_LIMIT) {
                         c2 = c2 - PUNCT_START + LATIN_LIMIT;  // 2000..203F -> 0180..01BF
                     } else if(c2 == 0xfffe || c2 == 0xffff) {
                         c2 = -1;  // U+FFFE & U+FFFF cannot occur in contractions.
@@ -885,9 +1002,10 @@ CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
                 c2 = s8[nextIndex++];
                 if(c2 > 0x7f) {
                     uint8_t t;
-                    if(c2 <= 0xc5 && 0xc2 <= c2 && nextIndex != sLength &&
+                    UChar32 leadStart = 0xc0 + (blockStart >> 6);
+                    if((uint32_t)(c2 - leadStart) <= 3 && nextIndex != sLength &&
                             0x80 <= (t = s8[nextIndex]) && t <= 0xbf) {
-                        c2 = ((c2 - 0xc2) << 6) + t;  // 0080..017F
+                        c2 = ((c2 - leadStart) << 6) + t;  // 0080..017F, or the script block
                         ++nextIndex;
                     } else {
                         int32_t i2 = nextIndex + 1;
@@ -16,6 +16,8 @@
 
 #if !UCONFIG_NO_COLLATION
 
+#include "unicode/uscript.h"
+
 U_NAMESPACE_BEGIN
 
 struct CollationData;
@@ -216,14 +218,87 @@ public:
                                const uint8_t *left, int32_t leftLength,
                                const uint8_t *right, int32_t rightLength);
 
+    // Fast script tables: Same format as the fast Latin table,
+    // but the 256 mini CEs after ASCII are for a block of another script.
+    // See the format description at the end of this file.
+
+    static const int32_t GREEK_SCRIPT_TABLE = 0;
+    static const int32_t CYRILLIC_SCRIPT_TABLE = 1;
+    static const int32_t ARABIC_SCRIPT_TABLE = 2;
+    static const int32_t NUM_SCRIPT_TABLES = 3;
+
+    /** Number of characters in the block of a fast script table. */
+    static const int32_t SCRIPT_BLOCK_LENGTH = 0x100;
+
+    /**
+     * Returns the index of the fast script table whose block contains c,
+     * or -1 if there is none.
+     */
+    static inline int32_t getScriptTableIndex(UChar32 c) {
+        switch(c >> 8) {
+        case 3: return GREEK_SCRIPT_TABLE;  // including the combining diacritical marks
+        case 4: return CYRILLIC_SCRIPT_TABLE;
+        case 6: return ARABIC_SCRIPT_TABLE;
+        default: return -1;
+        }
+    }
+
+    static inline UChar32 getScriptBlockStart(int32_t scriptTableIndex) {
+        return scriptTableIndex == ARABIC_SCRIPT_TABLE ? 0x600 : 0x300 + (scriptTableIndex << 8);
+    }
+
+    /** Returns the UScriptCode for the fast script table. */
+    static inline int32_t getScriptCode(int32_t scriptTableIndex) {
+        return scriptTableIndex == GREEK_SCRIPT_TABLE ? USCRIPT_GREEK :
+            scriptTableIndex == CYRILLIC_SCRIPT_TABLE ? USCRIPT_CYRILLIC : USCRIPT_ARABIC;
+    }
+
+    /**
+     * Computes the options value for compareScriptUTF16() and compareScriptUTF8().
+     * Returns -1 if the fastpath is not supported for the table and settings.
+     * There are no precomputed primary weights for fast script tables.
+     */
+    static int32_t getScriptOptions(const CollationData *data, const CollationSettings &settings,
+                                    const uint16_t *table, int32_t scriptTableIndex);
+
+    static int32_t compareScriptUTF16(const uint16_t *table, int32_t options,
+                                      int32_t scriptTableIndex,
+                                      const UChar *left, int32_t leftLength,
+                                      const UChar *right, int32_t rightLength);
+
+    static int32_t compareScriptUTF8(const uint16_t *table, int32_t options,
+                                     int32_t scriptTableIndex,
+                                     const uint8_t *left, int32_t leftLength,
+                                     const uint8_t *right, int32_t rightLength);
+
 private:
+    /**
+     * Shared implementation of the compare functions.
+     * The table maps ASCII and the 256 characters starting at blockStart.
+     * For the fast Latin table (isLatin), blockStart is U+0080
+     * and there are precomputed primaries.
+     */
+    template<UBool isLatin>
+    static int32_t doCompareUTF16(const uint16_t *table, const uint16_t *primaries, int32_t options,
+                                  UChar32 blockStart,
+                                  const UChar *left, int32_t leftLength,
+                                  const UChar *right, int32_t rightLength);
+    template<UBool isLatin>
+    static int32_t doCompareUTF8(const uint16_t *table, const uint16_t *primaries, int32_t options,
+                                 UChar32 blockStart,
+                                 const uint8_t *left, int32_t leftLength,
+                                 const uint8_t *right, int32_t rightLength);
+
+    template<UBool isLatin>
+    static inline uint32_t lookupSupported(const uint16_t *table, UChar32 blockStart, UChar32 c);
+
     static uint32_t lookup(const uint16_t *table, UChar32 c);
     static uint32_t lookupUTF8(const uint16_t *table, UChar32 c,
                                const uint8_t *s8, int32_t &sIndex, int32_t sLength);
-    static uint32_t lookupUTF8Unsafe(const uint16_t *table, UChar32 c,
+    static uint32_t lookupUTF8Unsafe(const uint16_t *table, UChar32 c, UChar32 blockStart,
                                      const uint8_t *s8, int32_t &sIndex);
 
-    static uint32_t nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
+    static uint32_t nextPair(const uint16_t *table, UChar32 c, uint32_t ce, UChar32 blockStart,
                              const UChar *s16, const uint8_t *s8, int32_t &sIndex, int32_t &sLength);
 
     static inline uint32_t getPrimaries(uint32_t variableTop, uint32_t pair) {
@@ -301,6 +376,22 @@ private:
  *   for when there is no contraction match.
  *
  * -----------------
+ * Fast script tables (not stored in the data, built at runtime)
+ *
+ * A fast script table has the same format as the fast Latin table.
+ * Its 256 mini CEs starting at index 0x80 are for the script block
+ * U+0300..U+03FF (Greek), U+0400..U+04FF (Cyrillic) or U+0600..U+06FF (Arabic)
+ * instead of U+0080..U+017F,
+ * and contraction suffix characters from that block are mapped the same way.
+ * In UTF-8, each block has four two-byte lead bytes, like U+0080..U+017F.
+ *
+ * The table supports only primaries up to the digits, and those of its script.
+ * Latin letters and other scripts bail out,
+ * so that the table can be used as long as reordering preserves the order of
+ * the special groups, the digits, and the script.
+ * The script's letters get short mini primaries; digits get long ones.
+ *
+ * -----------------
  * Changes for version 2 (ICU 55)
  *
  * Special reorder groups do not necessarily start on whole primary lead bytes any more.
@@ -29,6 +29,7 @@
 #include "collationdata.h"
 #include "collationfastlatin.h"
 #include "collationfastlatinbuilder.h"
+#include "normalizer2impl.h"
 #include "uassert.h"
 #include "uvectr64.h"
 
@@ -89,6 +90,7 @@ CollationFastLatinBuilder::CollationFastLatinBuilder(UErrorCode &errorCode)
           contractionCEs(errorCode), uniqueCEs(errorCode),
           miniCEs(NULL),
           firstDigitPrimary(0), firstLatinPrimary(0), lastLatinPrimary(0),
+          scriptTableIndex(-1), blockStart(0x80), firstScriptPrimary(0), lastScriptPrimary(0),
           firstShortPrimary(0), shortPrimaryOverflow(FALSE),
           headerLength(0) {
 }
@@ -133,6 +135,41 @@ CollationFastLatinBuilder::forData(const CollationData &data, UErrorCode &errorC
     return ok;
 }
 
+UBool
+CollationFastLatinBuilder::forScript(const CollationData &data, int32_t scriptIndex,
+                                     UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return FALSE; }
+    if(!result.isEmpty()) {  // This builder is not reusable.
+        errorCode = U_INVALID_STATE_ERROR;
+        return FALSE;
+    }
+    if(scriptIndex < 0 || CollationFastLatin::NUM_SCRIPT_TABLES <= scriptIndex) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+    if(!loadGroups(data, errorCode)) { return FALSE; }
+    scriptTableIndex = scriptIndex;
+    blockStart = CollationFastLatin::getScriptBlockStart(scriptIndex);
+    int32_t script = CollationFastLatin::getScriptCode(scriptIndex);
+    firstScriptPrimary = data.getFirstPrimaryForGroup(script);
+    lastScriptPrimary = data.getLastPrimaryForGroup(script);
+    if(firstScriptPrimary == 0) {
+        // missing data
+        return FALSE;
+    }
+
+    // Digits get long mini primaries, so that there are enough short primaries for letters.
+    // Unlike with the fast Latin table, a short-primary overflow is tolerated:
+    // The characters with the highest primaries then just bail out.
+    firstShortPrimary = firstScriptPrimary;
+    getCEs(data, errorCode);
+    UBool ok = encodeUniqueCEs(errorCode) &&
+            encodeCharCEs(errorCode) && encodeContractions(errorCode);
+    contractionCEs.removeAllElements();  // might reduce heap memory usage
+    uniqueCEs.removeAllElements();
+    return ok;
+}
+
 UBool
 CollationFastLatinBuilder::loadGroups(const CollationData &data, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return FALSE; }
@@ -157,6 +194,8 @@ CollationFastLatinBuilder::loadGroups(const CollationData &data, UErrorCode &err
         // missing data
         return FALSE;
     }
+    firstScriptPrimary = firstLatinPrimary;
+    lastScriptPrimary = lastLatinPrimary;
     return TRUE;
 }
 
@@ -191,6 +230,64 @@ CollationFastLatinBuilder::inSameGroup(uint32_t p, uint32_t q) const {
     }
 }
 
+UBool
+CollationFastLatinBuilder::isSupportedPrimary(uint32_t p) const {
+    // The primary must be below Latin (special groups & digits),
+    // or in the range of the table's script.
+    return p <= lastScriptPrimary && (p < firstLatinPrimary || firstScriptPrimary <= p);
+}
+
+namespace {
+
+/**
+ * Ranges of script-block characters for fast script tables, in pairs of [start, end].
+ * Only the letters of the most common alphabets are included,
+ * so that they all get short mini primaries.
+ */
+const UChar32 greekChars[] = { 0x370, 0x3ff, -1 };
+const UChar32 cyrillicChars[] = { 0x400, 0x45f, 0x490, 0x491, -1 };
+const UChar32 arabicChars[] = {
+    0x600, 0x64a,  // punctuation & Arabic letters
+    0x660, 0x669,  // digits
+    0x67e, 0x67e, 0x686, 0x686, 0x698, 0x698,  // Persian letters
+    0x6a9, 0x6a9, 0x6af, 0x6af, 0x6cc, 0x6cc,
+    0x6f0, 0x6f9,  // extended digits
+    -1
+};
+const UChar32 *const scriptChars[CollationFastLatin::NUM_SCRIPT_TABLES] = {
+    greekChars, cyrillicChars, arabicChars
+};
+
+}  // namespace
+
+UBool
+CollationFastLatinBuilder::isSupportedChar(const CollationData &data, UChar32 c) const {
+    if(scriptTableIndex < 0 || c <= 0x7f || CollationFastLatin::PUNCT_START <= c) {
+        return TRUE;
+    }
+    // The script blocks contain combining marks.
+    // Fast path comparisons skip the FCD check, so they must bail out
+    // on any character with a non-zero lead combining class.
+    if(data.nfcImpl.getFCD16(c) > 0xff) { return FALSE; }
+    for(const UChar32 *range = scriptChars[scriptTableIndex]; *range >= 0; range += 2) {
+        if(range[0] <= c && c <= range[1]) { return TRUE; }
+    }
+    return FALSE;
+}
+
+int32_t
+CollationFastLatinBuilder::getCharIndex(UChar c) const {
+    if(c <= 0x7f) {
+        return c;
+    } else if((uint32_t)(c - blockStart) < CollationFastLatin::SCRIPT_BLOCK_LENGTH) {
+        return c - blockStart + 0x80;
+    } else if(CollationFastLatin::PUNCT_START <= c && c < CollationFastLatin::PUNCT_LIMIT) {
+        return c - (CollationFastLatin::PUNCT_START - CollationFastLatin::LATIN_LIMIT);
+    } else {
+        return -1;
+    }
+}
+
 void
 CollationFastLatinBuilder::resetCEs() {
     contractionCEs.removeAllElements();
@@ -204,11 +301,18 @@ CollationFastLatinBuilder::getCEs(const CollationData &data, UErrorCode &errorCo
     if(U_FAILURE(errorCode)) { return; }
     int32_t i = 0;
     for(UChar c = 0;; ++i, ++c) {
-        if(c == CollationFastLatin::LATIN_LIMIT) {
+        if(c == 0x80) {
+            c = (UChar)blockStart;  // U+0080 for the fast Latin table
+        } else if(c == blockStart + CollationFastLatin::SCRIPT_BLOCK_LENGTH) {
             c = CollationFastLatin::PUNCT_START;
         } else if(c == CollationFastLatin::PUNCT_LIMIT) {
             break;
         }
+        if(!isSupportedChar(data, c)) {
+            charCEs[i][0] = ce0 = Collation::NO_CE;
+            charCEs[i][1] = ce1 = 0;
+            continue;
+        }
         const CollationData *d;
         uint32_t ce32 = data.getCE32(c);
         if(ce32 == Collation::FALLBACK_CE32) {
@@ -301,8 +405,9 @@ CollationFastLatinBuilder::getCEsFromCE32(const CollationData &data, UChar32 c,
     // We do not support an ignorable ce0 unless it is completely ignorable.
     uint32_t p0 = (uint32_t)(ce0 >> 32);
     if(p0 == 0) { return FALSE; }
-    // We only support primaries up to the Latin script.
-    if(p0 > lastLatinPrimary) { return FALSE; }
+    // We only support primaries up to the Latin script,
+    // or special & digit primaries together with those of the table's script.
+    if(!isSupportedPrimary(p0)) { return FALSE; }
     // We support non-common secondary and case weights only together with short primaries.
     uint32_t lower32_0 = (uint32_t)ce0;
     if(p0 < firstShortPrimary) {
@@ -319,6 +424,7 @@ CollationFastLatinBuilder::getCEsFromCE32(const CollationData &data, UChar32 c,
         // and determine for both whether they are variable.
         uint32_t p1 = (uint32_t)(ce1 >> 32);
         if(p1 == 0 ? p0 < firstShortPrimary : !inSameGroup(p0, p1)) { return FALSE; }
+        if(p1 != 0 && !isSupportedPrimary(p1)) { return FALSE; }
         uint32_t lower32_1 = (uint32_t)ce1;
         // No tertiary CEs.
         if((lower32_1 >> 16) == 0) { return FALSE; }
@@ -359,7 +465,7 @@ CollationFastLatinBuilder::getCEsFromContractionCE32(const CollationData &data,
     UCharsTrie::Iterator suffixes(p + 2, 0, errorCode);
     while(suffixes.next(errorCode)) {
         const UnicodeString &suffix = suffixes.getString();
-        int32_t x = CollationFastLatin::getCharIndex(suffix.charAt(0));
+        int32_t x = getCharIndex(suffix.charAt(0));
         if(x < 0) { continue; }  // ignore anything but fast Latin text
         if(x == prevX) {
             if(addContraction) {
@@ -33,6 +33,12 @@ public:
 
     UBool forData(const CollationData &data, UErrorCode &errorCode);
 
+    /**
+     * Builds a fast script table instead of the fast Latin table.
+     * @param scriptTableIndex one of CollationFastLatin::GREEK_SCRIPT_TABLE etc.
+     */
+    UBool forScript(const CollationData &data, int32_t scriptTableIndex, UErrorCode &errorCode);
+
     const uint16_t *getTable() const {
         return reinterpret_cast<const uint16_t *>(result.getBuffer());
     }
@@ -44,6 +50,9 @@ private:
 
     UBool loadGroups(const CollationData &data, UErrorCode &errorCode);
     UBool inSameGroup(uint32_t p, uint32_t q) const;
+    UBool isSupportedPrimary(uint32_t p) const;
+    UBool isSupportedChar(const CollationData &data, UChar32 c) const;
+    int32_t getCharIndex(UChar c) const;
 
     void resetCEs();
     void getCEs(const CollationData &data, UErrorCode &errorCode);
@@ -81,6 +90,11 @@ private:
     uint32_t firstDigitPrimary;
     uint32_t firstLatinPrimary;
     uint32_t lastLatinPrimary;
+    // The table's script: Latin for the fast Latin table.
+    int32_t scriptTableIndex;  // -1 for Latin
+    UChar32 blockStart;
+    uint32_t firstScriptPrimary;
+    uint32_t lastScriptPrimary;
     // This determines the first normal primary weight which is mapped to
     // a short mini primary. It must be >=firstDigitPrimary.
     uint32_t firstShortPrimary;
@@ -20,6 +20,7 @@
 #include "unicode/uvernum.h"
 #include "cmemory.h"
 #include "collationdata.h"
+#include "collationfastlatinbuilder.h"
 #include "collationsettings.h"
 #include "collationtailoring.h"
 #include "normalizer2impl.h"
@@ -37,6 +38,9 @@ CollationTailoring::CollationTailoring(const CollationSettings *baseSettings)
           builder(NULL), memory(NULL), bundle(NULL),
           trie(NULL), unsafeBackwardSet(NULL),
           maxExpansions(NULL) {
+    for(int32_t i = 0; i < CollationFastLatin::NUM_SCRIPT_TABLES; ++i) {
+        fastScriptTables[i] = NULL;
+    }
     if(baseSettings != NULL) {
         U_ASSERT(baseSettings->reorderCodesLength == 0);
         U_ASSERT(baseSettings->reorderTable == NULL);
@@ -50,6 +54,7 @@ CollationTailoring::CollationTailoring(const CollationSettings *baseSettings)
     rules.getTerminatedBuffer();  // ensure NUL-termination
     version[0] = version[1] = version[2] = version[3] = 0;
     maxExpansionsInitOnce.reset();
+    fastScriptTablesInitOnce.reset();
 }
 
 CollationTailoring::~CollationTailoring() {
@@ -62,6 +67,10 @@ CollationTailoring::~CollationTailoring() {
     delete unsafeBackwardSet;
     uhash_close(maxExpansions);
     maxExpansionsInitOnce.reset();
+    for(int32_t i = 0; i < CollationFastLatin::NUM_SCRIPT_TABLES; ++i) {
+        uprv_free(fastScriptTables[i]);
+    }
+    fastScriptTablesInitOnce.reset();
 }
 
 UBool
@@ -102,6 +111,36 @@ CollationTailoring::getUCAVersion() const {
     return ((int32_t)version[1] << 4) | (version[2] >> 6);
 }
 
+namespace {
+
+void U_CALLCONV
+buildFastScriptTables(const CollationTailoring *t, UErrorCode &errorCode) {
+    // Respect a tailoring that suppresses the Latin fastpath.
+    if(t->data->fastLatinTable == NULL) { return; }
+    for(int32_t i = 0; i < CollationFastLatin::NUM_SCRIPT_TABLES; ++i) {
+        CollationFastLatinBuilder builder(errorCode);
+        if(!builder.forScript(*t->data, i, errorCode)) { continue; }
+        int32_t length = builder.lengthOfTable();
+        uint16_t *table = (uint16_t *)uprv_malloc(length * 2);
+        if(table == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        uprv_memcpy(table, builder.getTable(), length * 2);
+        t->fastScriptTables[i] = table;
+    }
+}
+
+}  // namespace
+
+const uint16_t *
+CollationTailoring::getFastScriptTable(int32_t scriptTableIndex) const {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    umtx_initOnce(fastScriptTablesInitOnce, buildFastScriptTables, this, errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    return fastScriptTables[scriptTableIndex];
+}
+
 CollationCacheEntry::~CollationCacheEntry() {
     SharedObject::clearPtr(tailoring);
 }
@@ -19,6 +19,7 @@
 #include "unicode/locid.h"
 #include "unicode/unistr.h"
 #include "unicode/uversion.h"
+#include "collationfastlatin.h"
 #include "collationsettings.h"
 #include "uhash.h"
 #include "umutex.h"
@@ -58,6 +59,13 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     void setVersion(const UVersionInfo baseVersion, const UVersionInfo rulesVersion);
     int32_t getUCAVersion() const;
 
+    /**
+     * Returns the fast script table (see CollationFastLatin::compareScriptUTF16())
+     * for the given index, or NULL if there is none for this data.
+     * The tables are built on first use.
+     */
+    const uint16_t *getFastScriptTable(int32_t scriptTableIndex) const;
+
     // data for sorting etc.
     const CollationData *data;  // == base data or ownedData
     const CollationSettings *settings;  // reference-counted
@@ -81,6 +89,8 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     UnicodeSet *unsafeBackwardSet;
     mutable UHashtable *maxExpansions;
     mutable UInitOnce maxExpansionsInitOnce;
+    mutable uint16_t *fastScriptTables[CollationFastLatin::NUM_SCRIPT_TABLES];
+    mutable UInitOnce fastScriptTablesInitOnce;
 
 private:
     /**
@@ -7,8 +7,151 @@
 #ifndef COLLUNSAFE_H
 #define COLLUNSAFE_H
 
-#define COLLUNSAFE_ICU_VERSION "56.0.1"
+#define COLLUNSAFE_ICU_VERSION "56.1"
 #define COLLUNSAFE_COLL_VERSION "9.64"
+#define COLLUNSAFE_FROZEN 1
+static const int32_t unsafe_frozenCount = 840;
+static const uint32_t unsafe_frozenData[840] = { 
+0x27DA0020, 0x00000014, 0x00020000, 0x74655346, 0x00000001, 0x00000000,  // 6
+0x00000000, 0x00000000, 0x00000285, 0x000002CC, 0x00000000, 0x00000000,  // 12
+0x00000000, 0x00000000, 0x00000000, 0x00000D00, 0x00000034, 0x00000035,  // 18
+0x0000004C, 0x0000004D, 0x000000A0, 0x000000A1, 0x00000300, 0x0000034F,  // 24
+0x00000350, 0x00000370, 0x000003A9, 0x000003AA, 0x000003E2, 0x000003E3,  // 30
+0x0000042F, 0x00000430, 0x00000483, 0x00000488, 0x00000531, 0x00000532,  // 36
+0x00000591, 0x000005BE, 0x000005BF, 0x000005C0, 0x000005C1, 0x000005C3,  // 42
+0x000005C4, 0x000005C6, 0x000005C7, 0x000005C8, 0x000005D0, 0x000005D1,  // 48
+0x00000610, 0x0000061B, 0x00000628, 0x00000629, 0x0000064B, 0x00000660,  // 54
+0x00000670, 0x00000671, 0x000006D6, 0x000006DD, 0x000006DF, 0x000006E5,  // 60
+0x000006E7, 0x000006E9, 0x000006EA, 0x000006EE, 0x00000710, 0x00000712,  // 66
+0x00000730, 0x0000074B, 0x0000078C, 0x0000078D, 0x000007D8, 0x000007D9,  // 72
+0x000007EB, 0x000007F4, 0x00000800, 0x00000801, 0x00000816, 0x0000081A,  // 78
+0x0000081B, 0x00000824, 0x00000825, 0x00000828, 0x00000829, 0x0000082E,  // 84
+0x00000840, 0x00000841, 0x00000859, 0x0000085C, 0x000008E3, 0x00000900,  // 90
+0x00000905, 0x00000906, 0x0000093C, 0x0000093D, 0x0000094D, 0x0000094E,  // 96
+0x00000951, 0x00000955, 0x00000995, 0x00000996, 0x000009BC, 0x000009BD,  // 102
+0x000009BE, 0x000009BF, 0x000009CD, 0x000009CE, 0x000009D7, 0x000009D8,  // 108
+0x00000A15, 0x00000A16, 0x00000A3C, 0x00000A3D, 0x00000A4D, 0x00000A4E,  // 114
+0x00000A95, 0x00000A96, 0x00000ABC, 0x00000ABD, 0x00000ACD, 0x00000ACE,  // 120
+0x00000B15, 0x00000B16, 0x00000B3C, 0x00000B3D, 0x00000B3E, 0x00000B3F,  // 126
+0x00000B4D, 0x00000B4E, 0x00000B56, 0x00000B58, 0x00000B95, 0x00000B96,  // 132
+0x00000BBE, 0x00000BBF, 0x00000BCD, 0x00000BCE, 0x00000BD7, 0x00000BD8,  // 138
+0x00000C15, 0x00000C16, 0x00000C4D, 0x00000C4E, 0x00000C55, 0x00000C57,  // 144
+0x00000C95, 0x00000C96, 0x00000CBC, 0x00000CBD, 0x00000CC2, 0x00000CC3,  // 150
+0x00000CCD, 0x00000CCE, 0x00000CD5, 0x00000CD7, 0x00000D15, 0x00000D16,  // 156
+0x00000D3E, 0x00000D3F, 0x00000D4D, 0x00000D4E, 0x00000D57, 0x00000D58,  // 162
+0x00000D85, 0x00000D86, 0x00000DCA, 0x00000DCB, 0x00000DCF, 0x00000DD0,  // 168
+0x00000DDF, 0x00000DE0, 0x00000E01, 0x00000E2F, 0x00000E32, 0x00000E33,  // 174
+0x00000E38, 0x00000E3B, 0x00000E48, 0x00000E4C, 0x00000E81, 0x00000E83,  // 180
+0x00000E84, 0x00000E85, 0x00000E87, 0x00000E89, 0x00000E8A, 0x00000E8B,  // 186
+0x00000E8D, 0x00000E8E, 0x00000E94, 0x00000E98, 0x00000E99, 0x00000EA0,  // 192
+0x00000EA1, 0x00000EA4, 0x00000EA5, 0x00000EA6, 0x00000EA7, 0x00000EA8,  // 198
+0x00000EAA, 0x00000EAC, 0x00000EAD, 0x00000EAF, 0x00000EB2, 0x00000EB3,  // 204
+0x00000EB8, 0x00000EBA, 0x00000EC8, 0x00000ECC, 0x00000EDC, 0x00000EE0,  // 210
+0x00000F18, 0x00000F1A, 0x00000F35, 0x00000F36, 0x00000F37, 0x00000F38,  // 216
+0x00000F39, 0x00000F3A, 0x00000F40, 0x00000F41, 0x00000F71, 0x00000F76,  // 222
+0x00000F7A, 0x00000F7E, 0x00000F80, 0x00000F85, 0x00000F86, 0x00000F88,  // 228
+0x00000FC6, 0x00000FC7, 0x00001000, 0x00001001, 0x0000102E, 0x0000102F,  // 234
+0x00001037, 0x00001038, 0x00001039, 0x0000103B, 0x0000108D, 0x0000108E,  // 240
+0x000010D3, 0x000010D4, 0x000012A0, 0x000012A1, 0x0000135D, 0x00001360,  // 246
+0x000013C4, 0x000013C5, 0x000014C0, 0x000014C1, 0x0000168F, 0x00001690,  // 252
+0x000016A0, 0x000016A1, 0x00001703, 0x00001704, 0x00001714, 0x00001715,  // 258
+0x00001723, 0x00001724, 0x00001734, 0x00001735, 0x00001743, 0x00001744,  // 264
+0x00001763, 0x00001764, 0x00001780, 0x00001781, 0x000017D2, 0x000017D3,  // 270
+0x000017DD, 0x000017DE, 0x00001826, 0x00001827, 0x000018A9, 0x000018AA,  // 276
+0x00001900, 0x00001901, 0x00001939, 0x0000193C, 0x00001950, 0x00001951,  // 282
+0x00001980, 0x000019AC, 0x00001A00, 0x00001A01, 0x00001A17, 0x00001A19,  // 288
+0x00001A20, 0x00001A21, 0x00001A60, 0x00001A61, 0x00001A75, 0x00001A7D,  // 294
+0x00001A7F, 0x00001A80, 0x00001AB0, 0x00001ABE, 0x00001B05, 0x00001B06,  // 300
+0x00001B34, 0x00001B36, 0x00001B44, 0x00001B45, 0x00001B6B, 0x00001B74,  // 306
+0x00001B83, 0x00001B84, 0x00001BAA, 0x00001BAC, 0x00001BC0, 0x00001BC1,  // 312
+0x00001BE6, 0x00001BE7, 0x00001BF2, 0x00001BF4, 0x00001C00, 0x00001C01,  // 318
+0x00001C37, 0x00001C38, 0x00001C5A, 0x00001C5B, 0x00001CD0, 0x00001CD3,  // 324
+0x00001CD4, 0x00001CE1, 0x00001CE2, 0x00001CE9, 0x00001CED, 0x00001CEE,  // 330
+0x00001CF4, 0x00001CF5, 0x00001CF8, 0x00001CFA, 0x00001DC0, 0x00001DF6,  // 336
+0x00001DFC, 0x00001E00, 0x0000201C, 0x0000201D, 0x000020AC, 0x000020AD,  // 342
+0x000020D0, 0x000020DD, 0x000020E1, 0x000020E2, 0x000020E5, 0x000020F1,  // 348
+0x0000263A, 0x0000263B, 0x00002C00, 0x00002C01, 0x00002CEF, 0x00002CF2,  // 354
+0x00002D5E, 0x00002D5F, 0x00002D7F, 0x00002D80, 0x00002DE0, 0x00002E00,  // 360
+0x0000302A, 0x00003030, 0x0000304B, 0x0000304C, 0x00003099, 0x0000309B,  // 366
+0x000030AB, 0x000030AC, 0x00003105, 0x00003106, 0x00005B57, 0x00005B58,  // 372
+0x0000A288, 0x0000A289, 0x0000A4E8, 0x0000A4E9, 0x0000A549, 0x0000A54A,  // 378
+0x0000A66F, 0x0000A670, 0x0000A674, 0x0000A67E, 0x0000A69E, 0x0000A6A1,  // 384
+0x0000A6F0, 0x0000A6F2, 0x0000A800, 0x0000A801, 0x0000A806, 0x0000A807,  // 390
+0x0000A840, 0x0000A841, 0x0000A882, 0x0000A883, 0x0000A8C4, 0x0000A8C5,  // 396
+0x0000A8E0, 0x0000A8F2, 0x0000A90A, 0x0000A90B, 0x0000A92B, 0x0000A92E,  // 402
+0x0000A930, 0x0000A931, 0x0000A953, 0x0000A954, 0x0000A984, 0x0000A985,  // 408
+0x0000A9B3, 0x0000A9B4, 0x0000A9C0, 0x0000A9C1, 0x0000AA00, 0x0000AA01,  // 414
+0x0000AA80, 0x0000AAB1, 0x0000AAB2, 0x0000AAB5, 0x0000AAB7, 0x0000AAB9,  // 420
+0x0000AABE, 0x0000AAC0, 0x0000AAC1, 0x0000AAC2, 0x0000AAF6, 0x0000AAF7,  // 426
+0x0000ABC0, 0x0000ABC1, 0x0000ABED, 0x0000ABEE, 0x0000AC00, 0x0000AC01,  // 432
+0x0000D800, 0x0000D807, 0x0000D808, 0x0000D809, 0x0000D80C, 0x0000D80D,  // 438
+0x0000D811, 0x0000D812, 0x0000D81A, 0x0000D81C, 0x0000D82F, 0x0000D830,  // 444
+0x0000D834, 0x0000D835, 0x0000D83A, 0x0000D83B, 0x0000DC00, 0x0000E000,  // 450
+0x0000FB1E, 0x0000FB1F, 0x0000FDD0, 0x0000FDD1, 0x0000FE20, 0x0000FE30,  // 456
+0x00010000, 0x00010001, 0x000101FD, 0x000101FE, 0x00010280, 0x00010281,  // 462
+0x000102B7, 0x000102B8, 0x000102E0, 0x000102E1, 0x00010308, 0x00010309,  // 468
+0x00010330, 0x00010331, 0x0001036B, 0x0001036C, 0x00010376, 0x0001037B,  // 474
+0x00010380, 0x00010381, 0x000103A0, 0x000103A1, 0x00010414, 0x00010415,  // 480
+0x00010450, 0x00010451, 0x00010480, 0x00010481, 0x00010500, 0x00010501,  // 486
+0x00010537, 0x00010538, 0x00010647, 0x00010648, 0x00010800, 0x00010801,  // 492
+0x00010840, 0x00010841, 0x00010873, 0x00010874, 0x00010896, 0x00010897,  // 498
+0x000108F4, 0x000108F5, 0x00010900, 0x00010901, 0x00010920, 0x00010921,  // 504
+0x00010980, 0x00010981, 0x000109A0, 0x000109A1, 0x00010A00, 0x00010A01,  // 510
+0x00010A0D, 0x00010A0E, 0x00010A0F, 0x00010A10, 0x00010A38, 0x00010A3B,  // 516
+0x00010A3F, 0x00010A40, 0x00010A60, 0x00010A61, 0x00010A95, 0x00010A96,  // 522
+0x00010AC1, 0x00010AC2, 0x00010AE5, 0x00010AE7, 0x00010B00, 0x00010B01,  // 528
+0x00010B40, 0x00010B41, 0x00010B60, 0x00010B61, 0x00010B8F, 0x00010B90,  // 534
+0x00010C00, 0x00010C01, 0x00010CA1, 0x00010CA2, 0x00011005, 0x00011006,  // 540
+0x00011046, 0x00011047, 0x0001107F, 0x00011080, 0x00011083, 0x00011084,  // 546
+0x000110B9, 0x000110BB, 0x000110D0, 0x000110D1, 0x00011100, 0x00011104,  // 552
+0x00011127, 0x00011128, 0x00011133, 0x00011135, 0x00011152, 0x00011153,  // 558
+0x00011173, 0x00011174, 0x00011183, 0x00011184, 0x000111C0, 0x000111C1,  // 564
+0x000111CA, 0x000111CB, 0x00011208, 0x00011209, 0x00011235, 0x00011237,  // 570
+0x0001128F, 0x00011290, 0x000112BE, 0x000112BF, 0x000112E9, 0x000112EB,  // 576
+0x00011315, 0x00011316, 0x0001133C, 0x0001133D, 0x0001133E, 0x0001133F,  // 582
+0x0001134D, 0x0001134E, 0x00011357, 0x00011358, 0x00011366, 0x0001136D,  // 588
+0x00011370, 0x00011375, 0x00011484, 0x00011485, 0x000114B0, 0x000114B1,  // 594
+0x000114BA, 0x000114BB, 0x000114BD, 0x000114BE, 0x000114C2, 0x000114C4,  // 600
+0x0001158E, 0x0001158F, 0x000115AF, 0x000115B0, 0x000115BF, 0x000115C1,  // 606
+0x0001160E, 0x0001160F, 0x0001163F, 0x00011640, 0x00011680, 0x00011681,  // 612
+0x000116B6, 0x000116B8, 0x00011717, 0x00011718, 0x0001172B, 0x0001172C,  // 618
+0x000118B4, 0x000118B5, 0x00011AC0, 0x00011AC1, 0x00012000, 0x00012001,  // 624
+0x00013153, 0x00013154, 0x00014400, 0x00014401, 0x00016A4F, 0x00016A50,  // 630
+0x00016AE6, 0x00016AE7, 0x00016AF0, 0x00016AF5, 0x00016B1C, 0x00016B1D,  // 636
+0x00016B30, 0x00016B37, 0x00016F00, 0x00016F01, 0x0001BC20, 0x0001BC21,  // 642
+0x0001BC9E, 0x0001BC9F, 0x0001D165, 0x0001D16A, 0x0001D16D, 0x0001D173,  // 648
+0x0001D17B, 0x0001D183, 0x0001D185, 0x0001D18C, 0x0001D1AA, 0x0001D1AE,  // 654
+0x0001D242, 0x0001D245, 0x0001E802, 0x0001E803, 0x0001E8D0, 0x0001E8D7,  // 660
+0x00110000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,  // 666
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,  // 672
+0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000,  // 678
+0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000,  // 684
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,  // 690
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,  // 696
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,  // 702
+0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,  // 708
+0x00000000, 0x4C4C3434, 0x00000000, 0x00000002, 0x20003000, 0x20803000,  // 714
+0x20803000, 0x20043000, 0x20843000, 0x20843000, 0x20043000, 0x20843000,  // 720
+0x20003000, 0x20003000, 0x20003000, 0x02003000, 0x42003000, 0x02003000,  // 726
+0x02003000, 0x02001000, 0x13803000, 0x13403000, 0x03403000, 0x03403000,  // 732
+0x03403000, 0x03403000, 0x0B403000, 0x0B403000, 0x8B403000, 0x0B403000,  // 738
+0x0B403000, 0x0A403000, 0x0A403000, 0x02403000, 0x02403000, 0x0A403000,  // 744
+0x08403004, 0x08403000, 0x0840B000, 0x08403000, 0x08403000, 0x00403000,  // 750
+0x00403000, 0x08403000, 0x09403000, 0x00407000, 0x08403000, 0x88403000,  // 756
+0x88403000, 0x88403000, 0x80403000, 0x80413000, 0x92401000, 0x90501000,  // 762
+0x90401000, 0x90401000, 0x10401000, 0x10401000, 0x10401000, 0x10401000,  // 768
+0x10401000, 0x10401000, 0x10401000, 0x10401000, 0x10401000, 0x10401000,  // 774
+0x10001000, 0x10401000, 0x000E000E, 0x00080008, 0x000E000E, 0x00060006,  // 780
+0x00080008, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,  // 786
+0x04020402, 0x00000000, 0x00000000, 0x00020002, 0x00000000, 0x00020002,  // 792
+0x00000000, 0x00000000, 0x00000000, 0x04020402, 0x00000000, 0x04000400,  // 798
+0x00000000, 0x00000000, 0x00040004, 0x04000400, 0x04020402, 0x04000400,  // 804
+0x00020002, 0x00020002, 0x00020002, 0x00020002, 0x04030403, 0x04010401,  // 810
+0x04020402, 0x04010401, 0x04030403, 0x04030403, 0x04030403, 0x04010401,  // 816
+0x04030403, 0x00030003, 0x04030403, 0x04010401, 0x80038003, 0x00230023,  // 822
+0x00030003, 0x04030403, 0x04070407, 0x00030003, 0x00010001, 0x00070007,  // 828
+0x00010001, 0x00050005, 0x00010001, 0x80078007, 0x80018001, 0x00010001,  // 834
+0x00010001, 0x00010001, 0x00010001, 0x00010001, 0x00010001, 0x00010001};
 #define COLLUNSAFE_SERIALIZE 1
 static const int32_t unsafe_serializedCount = 850;
 static const uint16_t unsafe_serializedData[850] = { 
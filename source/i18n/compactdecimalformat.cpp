@@ -25,6 +25,7 @@
 #include "umutex.h"
 #include "unicode/ures.h"
 #include "uresimp.h"
+#include "visibledigits.h"
 
 // Maps locale name to CDFLocaleData struct.
 static UHashtable* gCompactDecimalData = NULL;
@@ -46,6 +47,14 @@ static const UChar u_apos = 0x27;
 
 static const UChar kZero[] = {u_0};
 
+// The plural keywords that CLDR uses, in the order of
+// CDFLocaleStyleData::unitsByPlural. "other" must be last.
+static const char* const gPluralKeywords[] = {
+  "zero", "one", "two", "few", "many", gOther
+};
+static const int32_t kPluralKeywordCount = UPRV_LENGTHOF(gPluralKeywords);
+static const int32_t kOtherIndex = kPluralKeywordCount - 1;
+
 // Used to unescape single quotes.
 enum QuoteState {
   OUTSIDE,
@@ -94,7 +103,13 @@ class CDFLocaleStyleData : public UMemory {
   // Compute cdfUnits = unitsByVariant[pluralVariant].
   // Prefix and suffix to use at cdfUnits[log10(x)]
   UHashtable* unitsByVariant;
-  inline CDFLocaleStyleData() : unitsByVariant(NULL) {}
+  // The CDFUnit[MAX_DIGITS] array in unitsByVariant for each of
+  // gPluralKeywords, with missing variants already resolved to "other",
+  // so that formatting needs no hash lookup.
+  const CDFUnit* unitsByPlural[kPluralKeywordCount];
+  inline CDFLocaleStyleData() : unitsByVariant(NULL) {
+    uprv_memset(unitsByPlural, 0, sizeof(unitsByPlural));
+  }
   ~CDFLocaleStyleData();
   // Init initializes this object.
   void Init(UErrorCode& status);
@@ -156,22 +171,24 @@ static int32_t populatePrefixSuffix(const char* variant, int32_t log10Value, con
 static UBool onlySpaces(UnicodeString u);
 static void fixQuotes(UnicodeString& s);
 static void fillInMissing(CDFLocaleStyleData* result);
+static void initUnitsByPlural(CDFLocaleStyleData* result);
+static int32_t getPluralIndex(const UnicodeString& variant);
 static int32_t computeLog10(double x, UBool inRange);
 static CDFUnit* createCDFUnit(const char* variant, int32_t log10Value, UHashtable* table, UErrorCode& status);
-static const CDFUnit* getCDFUnitFallback(const UHashtable* table, const UnicodeString& variant, int32_t log10Value);
 
 UOBJECT_DEFINE_RTTI_IMPLEMENTATION(CompactDecimalFormat)
 
 CompactDecimalFormat::CompactDecimalFormat(
     const DecimalFormat& decimalFormat,
     const UHashtable* unitsByVariant,
+    const CDFUnit* const* unitsByPlural,
     const double* divisors,
     PluralRules* pluralRules)
-  : DecimalFormat(decimalFormat), _unitsByVariant(unitsByVariant), _divisors(divisors), _pluralRules(pluralRules) {
+  : DecimalFormat(decimalFormat), _unitsByVariant(unitsByVariant), _unitsByPlural(unitsByPlural), _divisors(divisors), _pluralRules(pluralRules) {
 }
 
 CompactDecimalFormat::CompactDecimalFormat(const CompactDecimalFormat& source)
-    : DecimalFormat(source), _unitsByVariant(source._unitsByVariant), _divisors(source._divisors), _pluralRules(source._pluralRules->clone()) {
+    : DecimalFormat(source), _unitsByVariant(source._unitsByVariant), _unitsByPlural(source._unitsByPlural), _divisors(source._divisors), _pluralRules(source._pluralRules->clone()) {
 }
 
 CompactDecimalFormat* U_EXPORT2
@@ -190,7 +207,7 @@ CompactDecimalFormat::createInstance(
     return NULL;
   }
   CompactDecimalFormat* result =
-      new CompactDecimalFormat(*decfmt, data->unitsByVariant, data->divisors, pluralRules.getAlias());
+      new CompactDecimalFormat(*decfmt, data->unitsByVariant, data->unitsByPlural, data->divisors, pluralRules.getAlias());
   if (result == NULL) {
     status = U_MEMORY_ALLOCATION_ERROR;
     return NULL;
@@ -207,6 +224,7 @@ CompactDecimalFormat::operator=(const CompactDecimalFormat& rhs) {
   if (this != &rhs) {
     DecimalFormat::operator=(rhs);
     _unitsByVariant = rhs._unitsByVariant;
+    _unitsByPlural = rhs._unitsByPlural;
     _divisors = rhs._divisors;
     delete _pluralRules;
     _pluralRules = rhs._pluralRules->clone();
@@ -255,24 +273,22 @@ CompactDecimalFormat::format(
   if (U_FAILURE(status)) {
     return appendTo;
   }
-  DigitList orig, rounded;
-  orig.set(number);
-  UBool isNegative;
-  _round(orig, rounded, isNegative, status);
+  // Round to the significant digits in effect before picking the
+  // magnitude, so that e.g. 999999 is shown as 1M rather than 1000K.
+  VisibleDigitsWithExponent digits;
+  initVisibleDigitsWithExponent(number, digits, status);
   if (U_FAILURE(status)) {
     return appendTo;
   }
-  double roundedDouble = rounded.getDouble();
-  if (isNegative) {
-    roundedDouble = -roundedDouble;
-  }
+  UBool isNegative = digits.isNegative();
+  double roundedDouble = digits.getMantissa().getAbsDoubleValue();
   int32_t baseIdx = computeLog10(roundedDouble, TRUE);
   double numberToFormat = roundedDouble / _divisors[baseIdx];
   UnicodeString variant = _pluralRules->select(numberToFormat);
   if (isNegative) {
     numberToFormat = -numberToFormat;
   }
-  const CDFUnit* unit = getCDFUnitFallback(_unitsByVariant, variant, baseIdx);
+  const CDFUnit* unit = &_unitsByPlural[getPluralIndex(variant)][baseIdx];
   appendTo += unit->prefix;
   DecimalFormat::format(numberToFormat, appendTo, pos);
   appendTo += unit->suffix;
@@ -729,6 +745,7 @@ static void initCDFLocaleStyleData(const UResourceBundle* decimalFormatBundle, C
   }
   ures_close(power10);
   fillInMissing(result);
+  initUnitsByPlural(result);
 }
 
 // populatePower10 grabs data for a particular power of 10 from CLDR.
@@ -977,22 +994,34 @@ static CDFUnit* createCDFUnit(const char* variant, int32_t log10Value, UHashtabl
   return result;
 }
 
-// getCDFUnitFallback returns a pointer to the prefix-suffix pair for a given
-// variant and log10 value within table. If the given variant doesn't exist, it
-// falls back to the OTHER variant. Therefore, this method will always return
-// some non-NULL value.
-static const CDFUnit* getCDFUnitFallback(const UHashtable* table, const UnicodeString& variant, int32_t log10Value) {
-  CharString cvariant;
-  UErrorCode status = U_ZERO_ERROR;
-  const CDFUnit *cdfUnit = NULL;
-  cvariant.appendInvariantChars(variant, status);
-  if (!U_FAILURE(status)) {
-    cdfUnit = (const CDFUnit*) uhash_get(table, cvariant.data());
+// initUnitsByPlural resolves the CDFUnit array of each of gPluralKeywords
+// once, falling back to the "other" variant for variants missing from
+// result->unitsByVariant.
+static void initUnitsByPlural(CDFLocaleStyleData* result) {
+  const CDFUnit* otherUnits =
+      (const CDFUnit*) uhash_get(result->unitsByVariant, gOther);
+  for (int32_t i = 0; i < kPluralKeywordCount; ++i) {
+    const CDFUnit* units =
+        (const CDFUnit*) uhash_get(result->unitsByVariant, gPluralKeywords[i]);
+    result->unitsByPlural[i] = units != NULL ? units : otherUnits;
   }
-  if (cdfUnit == NULL) {
-    cdfUnit = (const CDFUnit*) uhash_get(table, gOther);
+}
+
+// getPluralIndex returns the index of variant in gPluralKeywords. Variants
+// that are not in gPluralKeywords get the index of "other".
+static int32_t getPluralIndex(const UnicodeString& variant) {
+  int32_t length = variant.length();
+  for (int32_t i = 0; i < kOtherIndex; ++i) {
+    const char* keyword = gPluralKeywords[i];
+    int32_t j = 0;
+    while (j < length && keyword[j] != 0 && variant.charAt(j) == (UChar) keyword[j]) {
+      ++j;
+    }
+    if (j == length && keyword[j] == 0) {
+      return i;
+    }
   }
-  return &cdfUnit[log10Value];
+  return kOtherIndex;
 }
 
 U_NAMESPACE_END
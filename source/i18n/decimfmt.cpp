@@ -45,6 +45,7 @@
 #include "unicode/currpinf.h"
 #include "unicode/plurrule.h"
 #include "unicode/utf16.h"
+#include "unicode/ustring.h"
 #include "unicode/numsys.h"
 #include "unicode/localpointer.h"
 #include "uresimp.h"
@@ -60,6 +61,8 @@
 #include "fmtableimp.h"
 #include "decimfmtimpl.h"
 #include "visibledigits.h"
+#include "shareddecimalformat.h"
+#include "unifiedcache.h"
 
 /*
  * On certain platforms, round is a macro defined in math.h
@@ -654,6 +657,121 @@ DecimalFormat::clone() const
     return new DecimalFormat(*this);
 }
 
+namespace {
+
+/**
+ * Cache key for a shared copy of a DecimalFormat.
+ * Two keys are equal when their formats compare equal and also agree in
+ * the settings that DecimalFormat::operator== ignores but parse() uses:
+ * the style, UNUM_PARSE_ALL_INPUT and the CurrencyPluralInfo.
+ */
+class DecimalFormatCacheKey : public CacheKey<SharedDecimalFormat> {
+public:
+    // A key for a lookup only refers to the caller's format.
+    // The key kept by the cache (see clone()) owns its own copy.
+    DecimalFormatCacheKey(const DecimalFormat &format, int32_t style,
+                          UNumberFormatAttributeValue parseAllInput)
+            : fFormat(&format), fOwned(NULL),
+              fStyle(style), fParseAllInput(parseAllInput) {
+        UnicodeString pattern;
+        fHash = format.toPattern(pattern).hashCode();
+    }
+    virtual ~DecimalFormatCacheKey();
+    virtual int32_t hashCode() const {
+        return 37 * CacheKey<SharedDecimalFormat>::hashCode() + fHash;
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<SharedDecimalFormat>::operator==(other)) {
+            return FALSE;
+        }
+        const DecimalFormatCacheKey &that = static_cast<const DecimalFormatCacheKey &>(other);
+        if (fStyle != that.fStyle || fParseAllInput != that.fParseAllInput ||
+                !(*fFormat == *that.fFormat)) {
+            return FALSE;
+        }
+        const CurrencyPluralInfo *info = fFormat->getCurrencyPluralInfo();
+        const CurrencyPluralInfo *thatInfo = that.fFormat->getCurrencyPluralInfo();
+        return info == thatInfo ||
+            (info != NULL && thatInfo != NULL && *info == *thatInfo);
+    }
+    virtual CacheKeyBase *clone() const {
+        DecimalFormat *copy = static_cast<DecimalFormat *>(fFormat->clone());
+        if (copy == NULL) {
+            return NULL;
+        }
+        DecimalFormatCacheKey *result = new DecimalFormatCacheKey(*this, copy);
+        if (result == NULL) {
+            delete copy;
+        }
+        return result;
+    }
+    virtual const SharedObject *createObject(
+            const void *creationContext, UErrorCode &status) const;
+private:
+    DecimalFormatCacheKey(const DecimalFormatCacheKey &other, DecimalFormat *formatToAdopt)
+            : CacheKey<SharedDecimalFormat>(other),
+              fFormat(formatToAdopt), fOwned(formatToAdopt),
+              fStyle(other.fStyle), fParseAllInput(other.fParseAllInput),
+              fHash(other.fHash) { }
+    DecimalFormatCacheKey(const DecimalFormatCacheKey &other);
+    DecimalFormatCacheKey &operator=(const DecimalFormatCacheKey &other);
+
+    const DecimalFormat *fFormat;
+    LocalPointer<DecimalFormat> fOwned;
+    int32_t fStyle;
+    UNumberFormatAttributeValue fParseAllInput;
+    int32_t fHash;
+};
+
+DecimalFormatCacheKey::~DecimalFormatCacheKey() {
+}
+
+const SharedObject *
+DecimalFormatCacheKey::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    DecimalFormat *copy = static_cast<DecimalFormat *>(fFormat->clone());
+    if (copy == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    SharedDecimalFormat *result = new SharedDecimalFormat(copy);
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        delete copy;
+        return NULL;
+    }
+    result->addRef();
+    return result;
+}
+
+}  // namespace
+
+SharedDecimalFormat::~SharedDecimalFormat() {
+    delete ptr;
+}
+
+const SharedDecimalFormat* U_EXPORT2
+DecimalFormat::createSharedInstance(const DecimalFormat &format, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const SharedDecimalFormat *result = NULL;
+#if UCONFIG_HAVE_PARSEALLINPUT
+    UNumberFormatAttributeValue parseAllInput = format.fParseAllInput;
+#else
+    UNumberFormatAttributeValue parseAllInput = UNUM_MAYBE;
+#endif
+    cache->get(DecimalFormatCacheKey(format, format.fStyle, parseAllInput), result, status);
+    return result;
+}
+
 
 FixedDecimal
 DecimalFormat::getFixedDecimal(double number, UErrorCode &status) const {
@@ -871,12 +989,112 @@ DecimalFormat::format(const VisibleDigitsWithExponent &number,
     return fImpl->format(number, appendTo, pos, status);
 }
 
-DigitList& 
-DecimalFormat::_round(const DigitList& number, DigitList& adjustedNum, UBool& isNegative, UErrorCode& status) const {
-    adjustedNum = number;
-    fImpl->round(adjustedNum, status);
-    isNegative = !adjustedNum.isPositive();
-    return adjustedNum;
+//------------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * UTF-16 scratch capacity for formatUTF8().
+ * Enough for all but unusually long affixes;
+ * longer results still work but are formatted into heap memory.
+ */
+const int32_t kFormatStackCapacity = 128;
+
+/**
+ * Formats into a writable alias of dest.
+ * The alias only moves to the heap if the result does not fit,
+ * in which case extract() reports U_BUFFER_OVERFLOW_ERROR.
+ */
+template<typename T>
+int32_t formatToUTF16(const DecimalFormatImpl &impl, T number,
+                      UChar *dest, int32_t destCapacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UnicodeString result(dest, 0, destCapacity);
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    impl.format(number, result, pos, status);
+    return result.extract(dest, destCapacity, status);
+}
+
+template<typename T>
+int32_t formatToUTF8(const DecimalFormatImpl &impl, T number,
+                     char *dest, int32_t destCapacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UChar stackBuffer[kFormatStackCapacity];
+    UnicodeString result(stackBuffer, 0, kFormatStackCapacity);
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    impl.format(number, result, pos, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t length = 0;
+    u_strToUTF8(dest, destCapacity, &length, result.getBuffer(), result.length(), &status);
+    return length;
+}
+
+}  // namespace
+
+int32_t
+DecimalFormat::format(int64_t number, UChar *dest, int32_t destCapacity,
+                      UErrorCode &status) const {
+    return formatToUTF16(*fImpl, number, dest, destCapacity, status);
+}
+
+int32_t
+DecimalFormat::format(double number, UChar *dest, int32_t destCapacity,
+                      UErrorCode &status) const {
+    return formatToUTF16(*fImpl, number, dest, destCapacity, status);
+}
+
+int32_t
+DecimalFormat::formatUTF8(int64_t number, char *dest, int32_t destCapacity,
+                          UErrorCode &status) const {
+    return formatToUTF8(*fImpl, number, dest, destCapacity, status);
+}
+
+int32_t
+DecimalFormat::formatUTF8(double number, char *dest, int32_t destCapacity,
+                          UErrorCode &status) const {
+    return formatToUTF8(*fImpl, number, dest, destCapacity, status);
+}
+
+UnicodeString &
+DecimalFormat::format(const int64_t *numbers, int32_t count,
+                      UnicodeString &appendTo, int32_t *offsets,
+                      UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    if (count < 0 || (numbers == NULL && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+    return fImpl->formatArray(numbers, count, appendTo, offsets, status);
+}
+
+UnicodeString &
+DecimalFormat::format(const double *numbers, int32_t count,
+                      UnicodeString &appendTo, int32_t *offsets,
+                      UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    if (count < 0 || (numbers == NULL && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+    return fImpl->formatArray(numbers, count, appendTo, offsets, status);
 }
 
 void
@@ -1239,6 +1457,11 @@ UBool DecimalFormat::subparse(const UnicodeString& text,
 
     UBool fastParseOk = false; /* TRUE iff fast parse is OK */
     // UBool fastParseHadDecimal = FALSE; /* true if fast parse saw a decimal point. */
+    // The fast parse accumulates the digits directly into an integer coefficient
+    // and a power of ten, so that no decimal string needs to be converted.
+    int64_t fastCoefficient = 0;
+    int32_t fastExponent = 0;
+    UBool fastNegative = FALSE;
     if((fImpl->isParseFastpath()) && !fImpl->fMonetary &&
        text.length()>0 &&
        text.length()<32 &&
@@ -1275,28 +1498,37 @@ UBool DecimalFormat::subparse(const UnicodeString& text,
         (strictParse)?'y':'n');
 #endif
       if(ch==0x002D) { // '-'
-        j=l+1;//=break - negative number.
-        
-        /*
-          parsedNum.append('-',err); 
+        // A plain ASCII minus is only taken here when it is exactly the
+        // negative affix; anything else needs the full affix matching.
+        if(negPrefix!=NULL && negPrefix->length()==1 && negPrefix->charAt(0)==0x002D &&
+           (negSuffix==NULL||negSuffix->isEmpty())) {
+          fastNegative = TRUE;
           j+=U16_LENGTH(ch);
-          if(j<l) ch = text.char32At(j);
-        */
-      } else {
-        parsedNum.append('+',err);
+          ch = text.char32At(j);
+        } else {
+          j=l+1;//=break - negative number.
+        }
       }
+      UBool sawFastDecimal = FALSE;
       while(j<l) {
         int32_t digit = ch - zero;
         if(digit >=0 && digit <= 9) {
-          parsedNum.append((char)(digit + '0'), err);
           if((digitCount>0) || digit!=0 || j==(l-1)) {
             digitCount++;
+            if(digitCount > MAX_I64_DIGITS - 1) {
+              digitCount=-1; // too many digits for the coefficient - slow parse
+              break;
+            }
+          }
+          fastCoefficient = fastCoefficient * 10 + digit;
+          if(sawFastDecimal) {
+            --fastExponent;
           }
         } else if(ch == 0) { // break out
           digitCount=-1;
           break;
         } else if(ch == decimalChar) {
-          parsedNum.append((char)('.'), err);
+          sawFastDecimal = TRUE;
           decimalChar=0; // no more decimals.
           // fastParseHadDecimal=TRUE;
         } else if(ch == lookForGroup) {
@@ -1319,7 +1551,6 @@ UBool DecimalFormat::subparse(const UnicodeString& text,
         debug("SKIP_OPT");
         /* for testing, try it the slow way. also */
         fastParseOk=false;
-        parsedNum.clear();
 #else
         parsePosition.setIndex(position=j);
         status[fgStatusInfinite]=false;
@@ -1329,7 +1560,6 @@ UBool DecimalFormat::subparse(const UnicodeString& text,
 #ifdef FMT_DEBUG
         printf("Fall through: j=%d, l=%d, digitCount=%d\n", j, l, digitCount);
 #endif
-        parsedNum.clear();
       }
     } else {
 #ifdef FMT_DEBUG
@@ -1341,9 +1571,6 @@ UBool DecimalFormat::subparse(const UnicodeString& text,
 #endif
     }
 
-  UnicodeString formatPattern;
-  toPattern(formatPattern);
-
   if(!fastParseOk 
 #if UCONFIG_HAVE_PARSEALLINPUT
      && fParseAllInput!=UNUM_YES
@@ -1643,6 +1870,8 @@ UBool DecimalFormat::subparse(const UnicodeString& text,
         // if we didn't see a decimal and it is required, check to see if the pattern had one
         if(!sawDecimal && isDecimalPatternMatchRequired()) 
         {
+            UnicodeString formatPattern;
+            toPattern(formatPattern);
             if(formatPattern.indexOf(DecimalFormatSymbols::kDecimalSeparatorSymbol) != 0) 
             {
                 parsePosition.setIndex(oldStart);
@@ -1753,10 +1982,17 @@ printf("PP -> %d, SLOW = [%s]!    pp=%d, os=%d, err=%s\n", position, parsedNum.d
     // uint32_t bits = (fastParseOk?kFastpathOk:0) |
     //   (fastParseHadDecimal?0:kNoDecimal);
     //printf("FPOK=%d, FPHD=%d, bits=%08X\n", fastParseOk, fastParseHadDecimal, bits);
-    digits.set(parsedNum.toStringPiece(),
-               err,
-               0//bits
-               );
+    if (fastParseOk) {
+        digits.set(fastCoefficient, fastExponent);
+        if (fastNegative) {
+            digits.setPositive(FALSE);
+        }
+    } else {
+        digits.set(parsedNum.toStringPiece(),
+                   err,
+                   0//bits
+                   );
+    }
 
     if (U_FAILURE(err)) {
 #ifdef FMT_DEBUG
@@ -1769,6 +2005,8 @@ printf("PP -> %d, SLOW = [%s]!    pp=%d, os=%d, err=%s\n", position, parsedNum.d
     // check if we missed a required decimal point
     if(fastParseOk && isDecimalPatternMatchRequired()) 
     {
+        UnicodeString formatPattern;
+        toPattern(formatPattern);
         if(formatPattern.indexOf(DecimalFormatSymbols::kDecimalSeparatorSymbol) != 0) 
         {
             parsePosition.setIndex(oldStart);
@@ -18,6 +18,7 @@
 #include "decimfmtimpl.h"
 #include "fphdlimp.h"
 #include "plurrule_impl.h"
+#include "putilimp.h"
 #include "valueformatter.h"
 #include "visibledigits.h"
 
@@ -457,6 +458,80 @@ DecimalFormatImpl::format(
             digits, appendTo, handler, status);
 }
 
+UnicodeString &
+DecimalFormatImpl::formatArray(
+        const int64_t *numbers,
+        int32_t count,
+        UnicodeString &appendTo,
+        int32_t *offsets,
+        UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    // Set up once for all of the numbers.
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    FieldPositionOnlyHandler handler(pos);
+    ValueFormatter vf;
+    prepareValueFormatter(vf);
+    UBool needsDigitList = !fMultiplier.isZero() || fScale != 0;
+    for (int32_t i = 0; i < count && U_SUCCESS(status); ++i) {
+        if (offsets != NULL) {
+            offsets[i] = appendTo.length();
+        }
+        if (needsDigitList) {
+            formatInt64(numbers[i], appendTo, handler, status);
+        } else {
+            fAffixes.formatInt64(
+                    numbers[i], vf, handler, fRules, appendTo, status);
+        }
+    }
+    if (offsets != NULL) {
+        offsets[count] = appendTo.length();
+    }
+    return appendTo;
+}
+
+UnicodeString &
+DecimalFormatImpl::formatArray(
+        const double *numbers,
+        int32_t count,
+        UnicodeString &appendTo,
+        int32_t *offsets,
+        UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    // Set up once for all of the numbers.
+    FieldPosition pos(FieldPosition::DONT_CARE);
+    FieldPositionOnlyHandler handler(pos);
+    ValueFormatter vf;
+    prepareValueFormatter(vf);
+    UBool needsDigitList = !fMultiplier.isZero() || fScale != 0;
+    for (int32_t i = 0; i < count && U_SUCCESS(status); ++i) {
+        if (offsets != NULL) {
+            offsets[i] = appendTo.length();
+        }
+        double number = numbers[i];
+        // Integers with at most 15 digits convert exactly, as with DigitList.
+        // Negative zero keeps its sign only via the double path.
+        if (!needsDigitList && number > -1e15 && number < 1e15 &&
+                number == uprv_floor(number) &&
+                (number != 0.0 || !uprv_isNegative(number))) {
+            fAffixes.formatInt64(
+                    (int64_t) number, vf, handler, fRules, appendTo, status);
+        } else {
+            VisibleDigitsWithExponent digits;
+            initVisibleDigitsWithExponent(number, digits, status);
+            fAffixes.format(
+                    digits, vf, handler, fRules, appendTo, status);
+        }
+    }
+    if (offsets != NULL) {
+        offsets[count] = appendTo.length();
+    }
+    return appendTo;
+}
+
 DigitList &
 DecimalFormatImpl::adjustDigitList(
         DigitList &number, UErrorCode &status) const {
@@ -610,18 +685,6 @@ DecimalFormatImpl::initVisibleDigitsFromAdjusted(
     return digits;
 }
 
-DigitList &
-DecimalFormatImpl::round(
-        DigitList &number, UErrorCode &status) const {
-    if (number.isNaN() || number.isInfinite()) {
-        return number;
-    }
-    adjustDigitList(number, status);
-    ValueFormatter vf;
-    prepareValueFormatter(vf);
-    return vf.round(number, status);
-}
-
 void
 DecimalFormatImpl::setMinimumSignificantDigits(int32_t newValue) {
     fMinSigDigits = newValue;
@@ -231,6 +231,18 @@ UnicodeString &format(
         UnicodeString &appendTo,
         FieldPositionIterator *posIter,
         UErrorCode &status) const;
+UnicodeString &formatArray(
+        const int64_t *numbers,
+        int32_t count,
+        UnicodeString &appendTo,
+        int32_t *offsets,
+        UErrorCode &status) const;
+UnicodeString &formatArray(
+        const double *numbers,
+        int32_t count,
+        UnicodeString &appendTo,
+        int32_t *offsets,
+        UErrorCode &status) const;
 
 UBool operator==(const DecimalFormatImpl &) const;
 
@@ -321,7 +333,6 @@ void setNegativeSuffix(const UnicodeString &str);
 UnicodeString &toPattern(UnicodeString& result) const;
 FixedDecimal &getFixedDecimal(double value, FixedDecimal &result, UErrorCode &status) const;
 FixedDecimal &getFixedDecimal(DigitList &number, FixedDecimal &result, UErrorCode &status) const;
-DigitList &round(DigitList &number, UErrorCode &status) const;
 
 VisibleDigitsWithExponent &
 initVisibleDigitsWithExponent(
@@ -63,6 +63,40 @@ DigitAffixesAndPadding::formatInt32(
     return suffix->format(handler, appendTo);
 }
 
+UnicodeString &
+DigitAffixesAndPadding::formatInt64(
+        int64_t value,
+        const ValueFormatter &formatter,
+        FieldPositionHandler &handler,
+        const PluralRules *optPluralRules,
+        UnicodeString &appendTo,
+        UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+    if (optPluralRules != NULL || fWidth > 0 || value == U_INT64_MIN || !formatter.isFastFormattableInt64()) {
+        VisibleDigitsWithExponent digits;
+        formatter.toVisibleDigitsWithExponent(
+                value, digits, status);
+        return format(
+                digits,
+                formatter,
+                handler,
+                optPluralRules,
+                appendTo,
+                status);
+    }
+    UBool bPositive = value >= 0;
+    const DigitAffix *prefix = bPositive ? &fPositivePrefix.getOtherVariant() : &fNegativePrefix.getOtherVariant();
+    const DigitAffix *suffix = bPositive ? &fPositiveSuffix.getOtherVariant() : &fNegativeSuffix.getOtherVariant();
+    if (value < 0) {
+        value = -value;
+    }
+    prefix->format(handler, appendTo);
+    formatter.formatInt64(value, handler, appendTo);
+    return suffix->format(handler, appendTo);
+}
+
 static UnicodeString &
 formatAffix(
         const DigitAffix *affix,
@@ -166,6 +166,26 @@ UnicodeString &formatInt32(
         UnicodeString &appendTo,
         UErrorCode &status) const;
 
+/**
+ * Formats a 64-bit integer and appends to appendTo. Like formatInt32,
+ * but the fast path also handles values that need digit grouping.
+ *
+ * @param value the value to format.
+ * @param formatter handles the details of formatting the actual value.
+ * @param handler records field positions
+ * @param optPluralRules the plural rules, but may be NULL if
+ *   needsPluralRules returns FALSE. 
+ * @appendTo formatted string appended here.
+ * @status any error returned here.
+ */
+UnicodeString &formatInt64(
+        int64_t value,
+        const ValueFormatter &formatter,
+        FieldPositionHandler &handler,
+        const PluralRules *optPluralRules,
+        UnicodeString &appendTo,
+        UErrorCode &status) const;
+
 private:
 UnicodeString &appendPadding(int32_t paddingCount, UnicodeString &appendTo) const;
 
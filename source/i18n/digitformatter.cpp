@@ -276,6 +276,23 @@ static int32_t formatInt(
     return idx;
 }
 
+static int32_t formatInt64(
+        int64_t value, uint8_t *digits) {
+    int32_t idx = 0;
+    // Two digits per division.
+    while (value >= 100) {
+        int32_t pair = (int32_t) (value % 100);
+        value /= 100;
+        digits[idx++] = (uint8_t) (pair % 10);
+        digits[idx++] = (uint8_t) (pair / 10);
+    }
+    while (value > 0) {
+        digits[idx++] = (uint8_t) (value % 10);
+        value /= 10;
+    }
+    return idx;
+}
+
 UnicodeString &
 DigitFormatter::formatDigits(
         const uint8_t *digits,
@@ -376,6 +393,45 @@ DigitFormatter::formatPositiveInt32(
             appendTo);
 }
 
+UnicodeString &
+DigitFormatter::formatPositiveInt64(
+        int64_t positiveValue,
+        const IntDigitCountRange &range,
+        const DigitGrouping &grouping,
+        FieldPositionHandler &handler,
+        UnicodeString &appendTo) const {
+    if (positiveValue <= INT32_MAX && grouping.isNoGrouping((int32_t) positiveValue, range)) {
+        return formatPositiveInt32((int32_t) positiveValue, range, handler, appendTo);
+    }
+    uint8_t digits[20];
+    int32_t count = formatInt64(positiveValue, digits);
+    int32_t digitsLeftOfDecimal = range.pin(count);
+    int32_t begin = appendTo.length();
+
+    // Always emit '0' as placeholder for empty string.
+    if (digitsLeftOfDecimal == 0) {
+        appendTo.append(fLocalizedDigits[0]);
+        handler.addAttribute(UNUM_INTEGER_FIELD, begin, appendTo.length());
+        return appendTo;
+    }
+    {
+        UnicodeStringAppender appender(appendTo);
+        for (int32_t i = digitsLeftOfDecimal - 1; i >= 0; --i) {
+            appender.append(fLocalizedDigits[i < count ? digits[i] : 0]);
+            if (grouping.isSeparatorAt(digitsLeftOfDecimal, i)) {
+                appender.flush();
+                appendField(
+                        UNUM_GROUPING_SEPARATOR_FIELD,
+                        fGroupingSeparator,
+                        handler,
+                        appendTo);
+            }
+        }
+    }
+    handler.addAttribute(UNUM_INTEGER_FIELD, begin, appendTo.length());
+    return appendTo;
+}
+
 UBool DigitFormatter::isStandardDigits() const {
     UChar32 cdigit = 0x30;
     for (int32_t i = 0; i < UPRV_LENGTHOF(fLocalizedDigits); ++i) {
@@ -192,6 +192,26 @@ UnicodeString &formatPositiveInt32(
         FieldPositionHandler &handler,
         UnicodeString &appendTo) const;
 
+/**
+ * Fixed point formatting of integers of any size.
+ * Performed with grouping but no decimal point.
+ * Unlike formatPositiveInt32, this does not require a VisibleDigits
+ * for values that need grouping.
+ *
+ * @param positiveValue the value to format must be positive.
+ * @param range specifies minimum and maximum number of digits.
+ * @param grouping controls how digit grouping is done
+ * @param handler records field positions
+ * @param appendTo formatted value appended here.
+ * @return appendTo
+ */
+UnicodeString &formatPositiveInt64(
+        int64_t positiveValue,
+        const IntDigitCountRange &range,
+        const DigitGrouping &grouping,
+        FieldPositionHandler &handler,
+        UnicodeString &appendTo) const;
+
 /**
  * Counts how many code points are needed for fixed formatting.
  *   If digits is negative, the negative sign is not included in the count.
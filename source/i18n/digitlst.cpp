@@ -420,8 +420,52 @@ char DigitList::getStrtodDecimalSeparator() {
 
 // -------------------------------------
 
+namespace {
+
+/** Powers of ten that are exactly representable as doubles. */
+const double kExactPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 /**
- * Currently, getDouble() depends on strtod() to do its conversion.
+ * Exact conversion of a finite decNumber to a double, for common values.
+ * If the coefficient fits into the double significand and the power of ten
+ * is exact, then a single IEEE multiplication or division yields
+ * the correctly rounded result.
+ * @return TRUE if the fast path applied and result was set
+ */
+UBool decNumberToDoubleFast(const decNumber &dn, double &result) {
+#if !defined(FLT_EVAL_METHOD) || (FLT_EVAL_METHOD != 0 && FLT_EVAL_METHOD != 1)
+    // Extended-precision intermediates would round twice.
+    (void)dn;
+    (void)result;
+    return FALSE;
+#else
+    int32_t exponent = dn.exponent;
+    if ((dn.bits & DECSPECIAL) != 0 || dn.digits > DBL_DIG || exponent > 22 || exponent < -22) {
+        return FALSE;
+    }
+    int64_t coefficient = 0;
+    for (int32_t i = dn.digits - 1; i >= 0; --i) {
+        coefficient = coefficient * 10 + dn.lsu[i];
+    }
+    double d = (double)coefficient;  // exact: less than 10^15 < 2^53
+    if (exponent >= 0) {
+        d *= kExactPowersOfTen[exponent];
+    } else {
+        d /= kExactPowersOfTen[-exponent];
+    }
+    result = (dn.bits & DECNEG) != 0 ? -d : d;
+    return TRUE;
+#endif
+}
+
+}  // namespace
+
+/**
+ * getDouble() converts common values exactly with decNumberToDoubleFast(),
+ * and otherwise depends on strtod() to do its conversion.
  *
  * WARNING!!
  * This is an extremely costly function. ~1/2 of the conversion time
@@ -467,6 +511,8 @@ DigitList::getDouble() const
         if (!isPositive()) {
             tDouble = -tDouble; //this was incorrectly "-fDouble" originally.
         } 
+    } else if (decNumberToDoubleFast(*fDecNumber, tDouble)) {
+        // Converted exactly without strtod().
     } else {
         MaybeStackArray<char, MAX_DBL_DIGITS+18> s;
            // Note:  14 is a  magic constant from the decNumber library documentation,
@@ -729,6 +775,23 @@ DigitList::set(int64_t source)
     internalSetDouble(static_cast<double>(source));
 }
 
+// -------------------------------------
+
+void
+DigitList::set(int64_t coefficient, int32_t exponent) {
+    U_ASSERT(coefficient >= 0);
+    U_ASSERT(fContext.digits >= MAX_DIGITS);
+    int32_t count = 0;
+    do {
+        fDecNumber->lsu[count++] = (uint8_t)(coefficient % 10);
+        coefficient /= 10;
+    } while (coefficient > 0);
+    fDecNumber->digits = count;
+    fDecNumber->exponent = exponent;
+    fDecNumber->bits = 0;
+    internalClear();
+}
+
 /**
  * Set an int64, with no decnumber
  */
@@ -804,21 +867,295 @@ DigitList::set(const StringPiece &source, UErrorCode &status, uint32_t /*fastpat
     internalClear();
 }   
 
+namespace {
+
+/*
+ * Shortest round-trip conversion of a double to decimal digits,
+ * using the Grisu2 algorithm by Florian Loitsch,
+ * "Printing Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010.
+ *
+ * The digits are guaranteed to convert back to the same double,
+ * and in the vast majority of cases they are the shortest such digit string.
+ */
+
+/** A "do-it-yourself floating point" value f*2^e with a 64-bit significand. */
+struct DiyFp {
+    uint64_t f;
+    int32_t e;
+};
+
+const uint64_t kDblSignificandMask = UINT64_C(0x000fffffffffffff);
+const uint64_t kDblHiddenBit = UINT64_C(0x0010000000000000);
+const int32_t kDblSignificandSize = 52;
+const int32_t kDblExponentBias = 0x3ff + kDblSignificandSize;
+const int32_t kDblMinExponent = -kDblExponentBias;
+
+DiyFp multiply(const DiyFp &x, const DiyFp &y) {
+    const uint64_t M32 = 0xffffffff;
+    uint64_t a = x.f >> 32, b = x.f & M32;
+    uint64_t c = y.f >> 32, d = y.f & M32;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+    tmp += (uint64_t)1 << 31;  // round
+    DiyFp result = { ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), x.e + y.e + 64 };
+    return result;
+}
+
+void normalize(DiyFp &x) {
+    while ((x.f & (kDblHiddenBit << 11)) == 0) {
+        x.f <<= 1;
+        --x.e;
+    }
+}
+
+/**
+ * Normalized powers of ten 10^-348, 10^-340, ..., 10^340,
+ * significands rounded to 64 bits.
+ */
+const uint64_t kCachedPowersF[] = {
+    UINT64_C(0xfa8fd5a0081c0288), UINT64_C(0xbaaee17fa23ebf76), UINT64_C(0x8b16fb203055ac76),
+    UINT64_C(0xcf42894a5dce35ea), UINT64_C(0x9a6bb0aa55653b2d), UINT64_C(0xe61acf033d1a45df),
+    UINT64_C(0xab70fe17c79ac6ca), UINT64_C(0xff77b1fcbebcdc4f), UINT64_C(0xbe5691ef416bd60c),
+    UINT64_C(0x8dd01fad907ffc3c), UINT64_C(0xd3515c2831559a83), UINT64_C(0x9d71ac8fada6c9b5),
+    UINT64_C(0xea9c227723ee8bcb), UINT64_C(0xaecc49914078536d), UINT64_C(0x823c12795db6ce57),
+    UINT64_C(0xc21094364dfb5637), UINT64_C(0x9096ea6f3848984f), UINT64_C(0xd77485cb25823ac7),
+    UINT64_C(0xa086cfcd97bf97f4), UINT64_C(0xef340a98172aace5), UINT64_C(0xb23867fb2a35b28e),
+    UINT64_C(0x84c8d4dfd2c63f3b), UINT64_C(0xc5dd44271ad3cdba), UINT64_C(0x936b9fcebb25c996),
+    UINT64_C(0xdbac6c247d62a584), UINT64_C(0xa3ab66580d5fdaf6), UINT64_C(0xf3e2f893dec3f126),
+    UINT64_C(0xb5b5ada8aaff80b8), UINT64_C(0x87625f056c7c4a8b), UINT64_C(0xc9bcff6034c13053),
+    UINT64_C(0x964e858c91ba2655), UINT64_C(0xdff9772470297ebd), UINT64_C(0xa6dfbd9fb8e5b88f),
+    UINT64_C(0xf8a95fcf88747d94), UINT64_C(0xb94470938fa89bcf), UINT64_C(0x8a08f0f8bf0f156b),
+    UINT64_C(0xcdb02555653131b6), UINT64_C(0x993fe2c6d07b7fac), UINT64_C(0xe45c10c42a2b3b06),
+    UINT64_C(0xaa242499697392d3), UINT64_C(0xfd87b5f28300ca0e), UINT64_C(0xbce5086492111aeb),
+    UINT64_C(0x8cbccc096f5088cc), UINT64_C(0xd1b71758e219652c), UINT64_C(0x9c40000000000000),
+    UINT64_C(0xe8d4a51000000000), UINT64_C(0xad78ebc5ac620000), UINT64_C(0x813f3978f8940984),
+    UINT64_C(0xc097ce7bc90715b3), UINT64_C(0x8f7e32ce7bea5c70), UINT64_C(0xd5d238a4abe98068),
+    UINT64_C(0x9f4f2726179a2245), UINT64_C(0xed63a231d4c4fb27), UINT64_C(0xb0de65388cc8ada8),
+    UINT64_C(0x83c7088e1aab65db), UINT64_C(0xc45d1df942711d9a), UINT64_C(0x924d692ca61be758),
+    UINT64_C(0xda01ee641a708dea), UINT64_C(0xa26da3999aef774a), UINT64_C(0xf209787bb47d6b85),
+    UINT64_C(0xb454e4a179dd1877), UINT64_C(0x865b86925b9bc5c2), UINT64_C(0xc83553c5c8965d3d),
+    UINT64_C(0x952ab45cfa97a0b3), UINT64_C(0xde469fbd99a05fe3), UINT64_C(0xa59bc234db398c25),
+    UINT64_C(0xf6c69a72a3989f5c), UINT64_C(0xb7dcbf5354e9bece), UINT64_C(0x88fcf317f22241e2),
+    UINT64_C(0xcc20ce9bd35c78a5), UINT64_C(0x98165af37b2153df), UINT64_C(0xe2a0b5dc971f303a),
+    UINT64_C(0xa8d9d1535ce3b396), UINT64_C(0xfb9b7cd9a4a7443c), UINT64_C(0xbb764c4ca7a44410),
+    UINT64_C(0x8bab8eefb6409c1a), UINT64_C(0xd01fef10a657842c), UINT64_C(0x9b10a4e5e9913129),
+    UINT64_C(0xe7109bfba19c0c9d), UINT64_C(0xac2820d9623bf429), UINT64_C(0x80444b5e7aa7cf85),
+    UINT64_C(0xbf21e44003acdd2d), UINT64_C(0x8e679c2f5e44ff8f), UINT64_C(0xd433179d9c8cb841),
+    UINT64_C(0x9e19db92b4e31ba9), UINT64_C(0xeb96bf6ebadf77d9), UINT64_C(0xaf87023b9bf0ee6b)
+};
+
+/** Binary exponents for kCachedPowersF[]. */
+const int16_t kCachedPowersE[] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007,  -980,
+     -954,  -927,  -901,  -874,  -847,  -821,  -794,  -768,  -741,  -715,
+     -688,  -661,  -635,  -608,  -582,  -555,  -529,  -502,  -475,  -449,
+     -422,  -396,  -369,  -343,  -316,  -289,  -263,  -236,  -210,  -183,
+     -157,  -130,  -103,   -77,   -50,   -24,     3,    30,    56,    83,
+      109,   136,   162,   189,   216,   242,   269,   295,   322,   348,
+      375,   402,   428,   455,   481,   508,   534,   561,   588,   614,
+      641,   667,   694,   720,   747,   774,   800,   827,   853,   880,
+      907,   933,   960,   986,  1013,  1039,  1066
+};
+
+const uint32_t kPow10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/**
+ * Returns a cached power of ten c such that multiplying a value
+ * with binary exponent e by it yields a binary exponent in [-60, -32].
+ * Sets K so that c approximates 10^-K.
+ */
+DiyFp getCachedPower(int32_t e, int32_t &K) {
+    double dk = (-61 - e) * 0.30102999566398114 + 347;  // 1/lg(10)
+    int32_t k = (int32_t)dk;
+    if (dk - k > 0.0) {
+        ++k;
+    }
+    int32_t index = (k >> 3) + 1;
+    K = -(-348 + index * 8);
+    DiyFp result = { kCachedPowersF[index], kCachedPowersE[index] };
+    return result;
+}
+
+void grisuRound(char *digits, int32_t length, uint64_t delta, uint64_t rest,
+                uint64_t tenKappa, uint64_t wpw) {
+    while (rest < wpw && (delta - rest) >= tenKappa &&
+            (rest + tenKappa < wpw || (wpw - rest) > (rest + tenKappa - wpw))) {
+        --digits[length - 1];
+        rest += tenKappa;
+    }
+}
+
+/**
+ * Generates the digits of Mp, stopping as soon as they are
+ * within delta of it, and rounds the last digit towards W.
+ * Returns the number of digits (values 0..9, not characters).
+ */
+int32_t digitGen(const DiyFp &W, const DiyFp &Mp, uint64_t delta, char *digits, int32_t &K) {
+    int32_t shift = -Mp.e;
+    uint64_t one = (uint64_t)1 << shift;
+    uint64_t wpw = Mp.f - W.f;
+    uint32_t p1 = (uint32_t)(Mp.f >> shift);
+    uint64_t p2 = Mp.f & (one - 1);
+    int32_t kappa = 10;
+    while (kappa > 1 && p1 < kPow10[kappa - 1]) {
+        --kappa;
+    }
+    int32_t length = 0;
+    while (kappa > 0) {
+        uint32_t d = p1 / kPow10[kappa - 1];
+        p1 %= kPow10[kappa - 1];
+        if (d != 0 || length != 0) {
+            digits[length++] = (char)d;
+        }
+        --kappa;
+        uint64_t rest = ((uint64_t)p1 << shift) + p2;
+        if (rest <= delta) {
+            K += kappa;
+            grisuRound(digits, length, delta, rest, (uint64_t)kPow10[kappa] << shift, wpw);
+            return length;
+        }
+    }
+    for (;;) {
+        p2 *= 10;
+        delta *= 10;
+        char d = (char)(p2 >> shift);
+        if (d != 0 || length != 0) {
+            digits[length++] = d;
+        }
+        p2 &= one - 1;
+        --kappa;
+        if (p2 < delta) {
+            K += kappa;
+            grisuRound(digits, length, delta, p2, one, -kappa < 10 ? wpw * kPow10[-kappa] : 0);
+            return length;
+        }
+    }
+}
+
+/**
+ * Converts a finite, non-zero, positive double to the digits d such that
+ * value == d * 10^K when read back.
+ * @param digits receives at least 17 digit values 0..9, most significant first
+ * @param K receives the decimal exponent of the last digit
+ * @return the number of digits
+ */
+int32_t grisu2(double value, char *digits, int32_t &K) {
+    uint64_t bits;
+    uprv_memcpy(&bits, &value, sizeof(bits));
+    int32_t biasedExponent = (int32_t)((bits >> kDblSignificandSize) & 0x7ff);
+    DiyFp v;
+    v.f = bits & kDblSignificandMask;
+    if (biasedExponent != 0) {
+        v.f += kDblHiddenBit;
+        v.e = biasedExponent - kDblExponentBias;
+    } else {
+        v.e = kDblMinExponent + 1;
+    }
+
+    // Boundaries m+ and m- halfway to the neighboring doubles, with the same exponent.
+    DiyFp plus = { (v.f << 1) + 1, v.e - 1 };
+    while ((plus.f & (kDblHiddenBit << 1)) == 0) {
+        plus.f <<= 1;
+        --plus.e;
+    }
+    plus.f <<= 64 - kDblSignificandSize - 2;
+    plus.e -= 64 - kDblSignificandSize - 2;
+    DiyFp minus;
+    if (v.f == kDblHiddenBit) {
+        // The lower neighbor is closer at a power of two.
+        minus.f = (v.f << 2) - 1;
+        minus.e = v.e - 2;
+    } else {
+        minus.f = (v.f << 1) - 1;
+        minus.e = v.e - 1;
+    }
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+
+    DiyFp cmk = getCachedPower(plus.e, K);
+    normalize(v);
+    DiyFp W = multiply(v, cmk);
+    DiyFp Wp = multiply(plus, cmk);
+    DiyFp Wm = multiply(minus, cmk);
+    // Shrink the interval by one unit on each side to make up for
+    // the imprecision of the cached power and the multiplication.
+    ++Wm.f;
+    --Wp.f;
+    return digitGen(W, Wp, Wp.f - Wm.f, digits, K);
+}
+
+}  // namespace
+
+UBool
+DigitList::getDoubleCoefficient(double source, int64_t &coefficient, int32_t &exponent) {
+    if (uprv_isNaN(source) || uprv_isInfinite(source)) {
+        return FALSE;
+    }
+    double magnitude = uprv_isNegative(source) ? -source : source;
+    coefficient = 0;
+    exponent = 0;
+    if (magnitude == 0.0) {
+        return TRUE;
+    }
+    if (magnitude < DBL_MIN) {
+        // Subnormal values have fewer than MAX_DBL_DIGITS digits of precision.
+        return FALSE;
+    }
+    char digits[20];
+    int32_t length = grisu2(magnitude, digits, exponent);
+    if (length > MAX_DBL_DIGITS) {
+        return FALSE;
+    }
+    // Same digits and exponent as "%.14e" with uprv_decNumberTrim():
+    // Pad to MAX_DBL_DIGITS, then remove trailing zeros
+    // from the fraction, or all of them from a positive exponent.
+    while (length < MAX_DBL_DIGITS) {
+        digits[length++] = 0;
+        --exponent;
+    }
+    while (exponent != 0 && digits[length - 1] == 0) {
+        --length;
+        ++exponent;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        coefficient = coefficient * 10 + digits[i];
+    }
+    return TRUE;
+}
+
 /**
  * Set the digit list to a representation of the given double value.
  * This method supports both fixed-point and exponential notation.
+ *
+ * Finite values are converted with Grisu2 directly into the decNumber digits.
+ * The result is the same as rounding the double to MAX_DBL_DIGITS significant digits
+ * and trimming trailing zeros: When the shortest round-trip digits fit into
+ * MAX_DBL_DIGITS, then they are the only such digit string that maps to this double.
+ * Longer digit strings fall back to the sprintf() conversion for correct rounding.
  * @param source Value to be converted.
  */
 void
 DigitList::set(double source)
 {
-    // for now, simple implementation; later, do proper IEEE stuff
+    int64_t coefficient;
+    int32_t exponent;
+    if (getDoubleCoefficient(source, coefficient, exponent)) {
+        set(coefficient, exponent);
+        if (uprv_isNegative(source)) {
+            fDecNumber->bits |= DECNEG;
+        }
+        internalSetDouble(source);
+        return;
+    }
+
     char rep[MAX_DIGITS + 8]; // Extra space for '+', '.', e+NNN, and '\0' (actually +8 is enough)
 
     // Generate a representation of the form /[+-][0-9].[0-9]+e[+-][0-9]+/
     // Can also generate /[+-]nan/ or /[+-]inf/
-    // TODO: Use something other than sprintf() here, since it's behavior is somewhat platform specific.
-    //       That is why infinity is special cased here.
+    // sprintf()'s behavior is somewhat platform specific.
+    // That is why infinity is special cased here.
     if (uprv_isInfinite(source)) {
         if (uprv_isNegativeInfinity(source)) {
             uprv_strcpy(rep,"-inf"); // Handle negative infinity
@@ -236,6 +236,18 @@ public:
      */
     void set(double source);
 
+    /**
+     * Computes the value that set(double) stores, without a decNumber:
+     * The absolute value of source, rounded to MAX_DBL_DIGITS significant
+     * digits and trimmed, as coefficient * 10^exponent.
+     * @param source The value to be converted.
+     * @param coefficient Receives the digits, at most MAX_DBL_DIGITS of them.
+     * @param exponent Receives the power of ten.
+     * @return FALSE for NaN and infinity, and for values that set(double)
+     *         converts the slow way, such as subnormals.
+     */
+    static UBool getDoubleCoefficient(double source, int64_t &coefficient, int32_t &exponent);
+
     /**
      * Utility routine to set the value of the digit list from a long.
      * If a non-zero maximumDigits is specified, no more than that number of
@@ -252,6 +264,14 @@ public:
      */
     void set(int64_t source);
 
+    /**
+     * Set the value to coefficient * 10^exponent, filling in the digits
+     * directly rather than going through a decimal string.
+     * @param coefficient The value of the digits, must be non-negative.
+     * @param exponent The power of ten to scale the coefficient by.
+     */
+    void set(int64_t coefficient, int32_t exponent);
+
     /**
      * Utility routine to set the value of the digit list from an int64.
      * Does not set the decnumber unless requested later
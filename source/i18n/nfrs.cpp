@@ -138,10 +138,12 @@ NFRuleSet::NFRuleSet(RuleBasedNumberFormat *_owner, UnicodeString* descriptions,
   , fIsFractionRuleSet(FALSE)
   , fIsPublic(FALSE)
   , fIsParseable(TRUE)
+  , fLeastCommonMultiple(0)
 {
     for (int32_t i = 0; i < NON_NUMERICAL_RULE_LENGTH; ++i) {
         nonNumericalRules[i] = NULL;
     }
+    uprv_memset(fSmallValueRuleIndexes, kNoRuleIndex, sizeof(fSmallValueRuleIndexes));
 
     if (U_FAILURE(status)) {
         return;
@@ -204,6 +206,7 @@ NFRuleSet::parseRules(UnicodeString& description, UErrorCode& status)
 
     // ensure we are starting with an empty rule list
     rules.deleteAll();
+    uprv_memset(fSmallValueRuleIndexes, kNoRuleIndex, sizeof(fSmallValueRuleIndexes));
 
     // dlf - the original code kept a separate description array for no reason,
     // so I got rid of it.  The loop was too complex so I simplified it.
@@ -257,6 +260,56 @@ NFRuleSet::parseRules(UnicodeString& description, UErrorCode& status)
             ++defaultBaseValue;
         }
     }
+    initSmallValueRuleIndexes();
+    initLeastCommonMultiple();
+}
+
+/**
+ * Remembers which rule findNormalRule() picks for each value below
+ * kSmallValueLimit.  Every number is eventually broken down into such
+ * values, so this saves a binary search and a rollback check for most
+ * of the rules applied while formatting.
+ */
+void
+NFRuleSet::initSmallValueRuleIndexes()
+{
+    if (fIsFractionRuleSet || rules.size() >= kNoRuleIndex) {
+        return;
+    }
+    for (int32_t n = 0; n < kSmallValueLimit; ++n) {
+        const NFRule *rule = findNormalRule(n);
+        for (uint32_t i = 0; i < rules.size(); ++i) {
+            if (rules[i] == rule) {
+                fSmallValueRuleIndexes[n] = (uint8_t)i;
+                break;
+            }
+        }
+    }
+}
+
+void
+NFRuleSet::makeIntoFractionRuleSet()
+{
+    fIsFractionRuleSet = TRUE;
+    initLeastCommonMultiple();
+}
+
+/**
+ * Computes the least common multiple of the rules' base values once,
+ * rather than on every call to findFractionRuleSetRule().
+ */
+void
+NFRuleSet::initLeastCommonMultiple()
+{
+    fLeastCommonMultiple = 0;
+    if (!fIsFractionRuleSet || rules.size() == 0) {
+        return;
+    }
+    int64_t leastCommonMultiple = rules[0]->getBaseValue();
+    for (uint32_t i = 1; i < rules.size(); ++i) {
+        leastCommonMultiple = util_lcm(leastCommonMultiple, rules[i]->getBaseValue());
+    }
+    fLeastCommonMultiple = leastCommonMultiple;
 }
 
 /**
@@ -512,6 +565,13 @@ NFRuleSet::findNormalRule(int64_t number) const
     // {dlf} unfortunately this fails if there are no rules except
     // special rules.  If there are no rules, use the master rule.
 
+    if (number >= 0 && number < kSmallValueLimit) {
+        int32_t index = fSmallValueRuleIndexes[number];
+        if (index != kNoRuleIndex) {
+            return rules[index];
+        }
+    }
+
     // binary-search the rule list for the applicable rule
     // (a rule is used for all values from its base value to
     // the next rule's base value)
@@ -581,11 +641,14 @@ NFRuleSet::findFractionRuleSetRule(double number) const
     // and multiply this by the number being formatted.  This is
     // all the precision we need, and we can do all of the rest
     // of the math using integer arithmetic
-    int64_t leastCommonMultiple = rules[0]->getBaseValue();
+    int64_t leastCommonMultiple = fLeastCommonMultiple;
     int64_t numerator;
     {
-        for (uint32_t i = 1; i < rules.size(); ++i) {
-            leastCommonMultiple = util_lcm(leastCommonMultiple, rules[i]->getBaseValue());
+        if (leastCommonMultiple == 0) {
+            leastCommonMultiple = rules[0]->getBaseValue();
+            for (uint32_t i = 1; i < rules.size(); ++i) {
+                leastCommonMultiple = util_lcm(leastCommonMultiple, rules[i]->getBaseValue());
+            }
         }
         numerator = util64_fromDouble(number * (double)leastCommonMultiple + 0.5);
     }
@@ -34,7 +34,7 @@ public:
     void parseRules(UnicodeString& rules, UErrorCode& status);
     void setNonNumericalRule(NFRule *rule);
     void setBestFractionRule(int32_t originalIndex, NFRule *newRule, UBool rememberRule);
-    void makeIntoFractionRuleSet() { fIsFractionRuleSet = TRUE; }
+    void makeIntoFractionRuleSet();
 
     ~NFRuleSet();
 
@@ -64,10 +64,17 @@ private:
     const NFRule * findNormalRule(int64_t number) const;
     const NFRule * findDoubleRule(double number) const;
     const NFRule * findFractionRuleSetRule(double number) const;
+    void initSmallValueRuleIndexes();
+    void initLeastCommonMultiple();
     
     friend class NFSubstitution;
 
 private:
+    enum {
+        kSmallValueLimit = 100,  // Values 0..99 are looked up in fSmallValueRuleIndexes.
+        kNoRuleIndex = 0xff      // findNormalRule() searches the rules instead.
+    };
+
     UnicodeString name;
     NFRuleList rules;
     NFRule *nonNumericalRules[6];
@@ -76,6 +83,12 @@ private:
     UBool fIsFractionRuleSet;
     UBool fIsPublic;
     UBool fIsParseable;
+    // For each value below kSmallValueLimit, the index in rules of the
+    //   rule that findNormalRule() returns for it, or kNoRuleIndex.
+    uint8_t fSmallValueRuleIndexes[kSmallValueLimit];
+    // For a fraction rule set, the least common multiple of the rules'
+    //   base values; 0 if it has not been computed.
+    int64_t fLeastCommonMultiple;
 
     NFRuleSet(const NFRuleSet &other); // forbid copying of this class
     NFRuleSet &operator=(const NFRuleSet &other); // forbid copying of this class
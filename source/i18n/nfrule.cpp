@@ -41,6 +41,8 @@ NFRule::NFRule(const RuleBasedNumberFormat* _rbnf, const UnicodeString &_ruleTex
   , sub2(NULL)
   , formatter(_rbnf)
   , rulePatternFormat(NULL)
+  , rulePatternStart(-1)
+  , rulePatternEnd(-1)
 {
     if (!ruleText.isEmpty()) {
         parseRuleDescriptor(ruleText, status);
@@ -446,6 +448,8 @@ NFRule::extractSubstitutions(const NFRuleSet* ruleSet,
         }
         rulePatternFormat = formatter->createPluralFormat(pluralType,
                 this->ruleText.tempSubString(endType + 1, pluralRuleEnd - endType - 1), status);
+        rulePatternStart = pluralRuleStart;
+        rulePatternEnd = pluralRuleEnd;
     }
 }
 
@@ -740,8 +744,8 @@ NFRule::doFormat(int64_t number, UnicodeString& toInsertInto, int32_t pos, int32
         toInsertInto.insert(pos, ruleText);
     }
     else {
-        pluralRuleStart = ruleText.indexOf(gDollarOpenParenthesis, -1, 0);
-        int pluralRuleEnd = ruleText.indexOf(gClosedParenthesisDollar, -1, pluralRuleStart);
+        pluralRuleStart = rulePatternStart;
+        int pluralRuleEnd = rulePatternEnd;
         int initialLength = toInsertInto.length();
         if (pluralRuleEnd < ruleText.length() - 1) {
             toInsertInto.insert(pos, ruleText.tempSubString(pluralRuleEnd + 2));
@@ -786,8 +790,8 @@ NFRule::doFormat(double number, UnicodeString& toInsertInto, int32_t pos, int32_
         toInsertInto.insert(pos, ruleText);
     }
     else {
-        pluralRuleStart = ruleText.indexOf(gDollarOpenParenthesis, -1, 0);
-        int pluralRuleEnd = ruleText.indexOf(gClosedParenthesisDollar, -1, pluralRuleStart);
+        pluralRuleStart = rulePatternStart;
+        int pluralRuleEnd = rulePatternEnd;
         int initialLength = toInsertInto.length();
         if (pluralRuleEnd < ruleText.length() - 1) {
             toInsertInto.insert(pos, ruleText.tempSubString(pluralRuleEnd + 2));
@@ -111,6 +111,9 @@ private:
     NFSubstitution* sub2;
     const RuleBasedNumberFormat* formatter;
     const PluralFormat* rulePatternFormat;
+    // Where "$(" and ")$" are in ruleText when there is a rulePatternFormat.
+    int32_t rulePatternStart;
+    int32_t rulePatternEnd;
 
     NFRule(const NFRule &other); // forbid copying of this class
     NFRule &operator=(const NFRule &other); // forbid copying of this class
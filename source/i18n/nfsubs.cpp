@@ -584,9 +584,14 @@ NFSubstitution::doSubstitution(int64_t number, UnicodeString& toInsertInto, int3
             numberToFormat = uprv_floor(numberToFormat);
         }
 
-        UnicodeString temp;
-        numberFormat->format(numberToFormat, temp, status);
-        toInsertInto.insert(_pos + this->pos, temp);
+        if (_pos + this->pos == toInsertInto.length()) {
+            // Nothing follows, so format straight into the result.
+            numberFormat->format(numberToFormat, toInsertInto, status);
+        } else {
+            UnicodeString temp;
+            numberFormat->format(numberToFormat, temp, status);
+            toInsertInto.insert(_pos + this->pos, temp);
+        }
     }
 }
 
@@ -625,9 +630,13 @@ NFSubstitution::doSubstitution(double number, UnicodeString& toInsertInto, int32
         if (ruleSet != NULL) {
             ruleSet->format(numberToFormat, toInsertInto, _pos + this->pos, recursionCount, status);
         } else if (numberFormat != NULL) {
-            UnicodeString temp;
-            numberFormat->format(numberToFormat, temp);
-            toInsertInto.insert(_pos + this->pos, temp);
+            if (_pos + this->pos == toInsertInto.length()) {
+                numberFormat->format(numberToFormat, toInsertInto);
+            } else {
+                UnicodeString temp;
+                numberFormat->format(numberToFormat, temp);
+                toInsertInto.insert(_pos + this->pos, temp);
+            }
         }
     }
 }
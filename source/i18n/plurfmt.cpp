@@ -259,41 +259,21 @@ PluralFormat::format(const Formattable& numberObject, double number,
     // Get the appropriate sub-message.
     // Select it based on the formatted number-offset.
     double numberMinusOffset = number - offset;
-    UnicodeString numberString;
-    FieldPosition ignorePos;
-    FixedPrecision fp;
     VisibleDigitsWithExponent dec;
-    fp.initVisibleDigitsWithExponent(numberMinusOffset, dec, status);
+    DecimalFormat *decFmt = dynamic_cast<DecimalFormat *>(numberFormat);
+    if (decFmt == NULL) {
+        FixedPrecision fp;
+        fp.initVisibleDigitsWithExponent(numberMinusOffset, dec, status);
+    } else if (offset == 0) {
+        decFmt->initVisibleDigitsWithExponent(
+                numberObject, dec, status);
+    } else {
+        decFmt->initVisibleDigitsWithExponent(
+                numberMinusOffset, dec, status);
+    }
     if (U_FAILURE(status)) {
         return appendTo;
     }
-    if (offset == 0) {
-        DecimalFormat *decFmt = dynamic_cast<DecimalFormat *>(numberFormat);
-        if(decFmt != NULL) {
-            decFmt->initVisibleDigitsWithExponent(
-                    numberObject, dec, status);
-            if (U_FAILURE(status)) {
-                return appendTo;
-            }
-            decFmt->format(dec, numberString, ignorePos, status);
-        } else {
-            numberFormat->format(
-                    numberObject, numberString, ignorePos, status);  // could be BigDecimal etc.
-        }
-    } else {
-        DecimalFormat *decFmt = dynamic_cast<DecimalFormat *>(numberFormat);
-        if(decFmt != NULL) {
-            decFmt->initVisibleDigitsWithExponent(
-                    numberMinusOffset, dec, status);
-            if (U_FAILURE(status)) {
-                return appendTo;
-            }
-            decFmt->format(dec, numberString, ignorePos, status);
-        } else {
-            numberFormat->format(
-                    numberMinusOffset, numberString, ignorePos, status);
-        }
-    }
     int32_t partIndex = findSubMessage(msgPattern, 0, pluralRulesWrapper, &dec, number, status);
     if (U_FAILURE(status)) { return appendTo; }
     // Replace syntactic # signs in the top level of this sub-message
@@ -310,7 +290,18 @@ PluralFormat::format(const Formattable& numberObject, double number,
             (type == UMSGPAT_PART_TYPE_SKIP_SYNTAX && MessageImpl::jdkAposMode(msgPattern))) {
             appendTo.append(pattern, prevIndex, index - prevIndex);
             if (type == UMSGPAT_PART_TYPE_REPLACE_NUMBER) {
-                appendTo.append(numberString);
+                // Most sub-messages have no #, so only format the
+                // number-offset when one is found.
+                FieldPosition ignorePos;
+                if (decFmt != NULL) {
+                    decFmt->format(dec, appendTo, ignorePos, status);
+                } else if (offset == 0) {
+                    numberFormat->format(
+                            numberObject, appendTo, ignorePos, status);  // could be BigDecimal etc.
+                } else {
+                    numberFormat->format(
+                            numberMinusOffset, appendTo, ignorePos, status);
+                }
             }
             prevIndex = part.getLimit();
         } else if (type == UMSGPAT_PART_TYPE_ARG_START) {
@@ -238,7 +238,8 @@ PluralRules::internalForLocale(const Locale& locale, UPluralType type, UErrorCod
 
 UnicodeString
 PluralRules::select(int32_t number) const {
-    return select(FixedDecimal(number));
+    // An int32_t has no fraction digits.
+    return select(FixedDecimal(number, 0, 0));
 }
 
 UnicodeString
@@ -625,6 +626,9 @@ PluralRuleParser::parse(const UnicodeString& ruleData, PluralRules *prules, UErr
             break;
         }
     }
+    if (U_SUCCESS(status) && prules->mRules != NULL) {
+        prules->mRules->buildIntegerTable(status);
+    }
 }
 
 UnicodeString
@@ -870,30 +874,85 @@ OrConstraint::isFulfilled(const FixedDecimal &number) {
 
 
 RuleChain::RuleChain(): fKeyword(), fNext(NULL), ruleHeader(NULL), fDecimalSamples(), fIntegerSamples(), 
-                        fDecimalSamplesUnbounded(FALSE), fIntegerSamplesUnbounded(FALSE) {
+                        fDecimalSamplesUnbounded(FALSE), fIntegerSamplesUnbounded(FALSE),
+                        fIntegerRuleIndexes(NULL) {
 }
 
 RuleChain::RuleChain(const RuleChain& other) : 
         fKeyword(other.fKeyword), fNext(NULL), ruleHeader(NULL), fDecimalSamples(other.fDecimalSamples),
         fIntegerSamples(other.fIntegerSamples), fDecimalSamplesUnbounded(other.fDecimalSamplesUnbounded), 
-        fIntegerSamplesUnbounded(other.fIntegerSamplesUnbounded) {
+        fIntegerSamplesUnbounded(other.fIntegerSamplesUnbounded), fIntegerRuleIndexes(NULL) {
     if (other.ruleHeader != NULL) {
         this->ruleHeader = new OrConstraint(*(other.ruleHeader));
     }
     if (other.fNext != NULL ) {
         this->fNext = new RuleChain(*other.fNext);
     }
+    if (other.fIntegerRuleIndexes != NULL) {
+        // Without the table, select() just evaluates the rules.
+        this->fIntegerRuleIndexes = (uint8_t *)uprv_malloc(kIntegerTableSize);
+        if (this->fIntegerRuleIndexes != NULL) {
+            uprv_memcpy(this->fIntegerRuleIndexes, other.fIntegerRuleIndexes, kIntegerTableSize);
+        }
+    }
 }
 
 RuleChain::~RuleChain() {
     delete fNext;
     delete ruleHeader;
+    uprv_free(fIntegerRuleIndexes);
+}
+
+
+void
+RuleChain::buildIntegerTable(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t ruleCount = 0;
+    for (const RuleChain *rules = this; rules != NULL; rules = rules->fNext) {
+        ++ruleCount;
+    }
+    if (ruleCount >= kNoRuleIndex) {
+        return;
+    }
+    uint8_t *table = (uint8_t *)uprv_malloc(kIntegerTableSize);
+    if (table == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t n = 0; n < kIntegerTableSize; ++n) {
+        FixedDecimal number(n, 0, 0);
+        uint8_t index = 0;
+        const RuleChain *rules = this;
+        while (rules != NULL && !rules->ruleHeader->isFulfilled(number)) {
+            rules = rules->fNext;
+            ++index;
+        }
+        table[n] = rules != NULL ? index : (uint8_t)kNoRuleIndex;
+    }
+    uprv_free(fIntegerRuleIndexes);
+    fIntegerRuleIndexes = table;
 }
 
 
 UnicodeString
 RuleChain::select(const FixedDecimal &number) const {
     if (!number.isNanOrInfinity) {
+        if (fIntegerRuleIndexes != NULL && number.hasIntegerValue &&
+                number.visibleDecimalDigitCount == 0 && number.decimalDigits == 0 &&
+                number.intValue < kIntegerTableSize) {
+            // All operands are determined by the integer value: n = i, v = f = t = 0.
+            int32_t index = fIntegerRuleIndexes[number.intValue];
+            if (index != kNoRuleIndex) {
+                const RuleChain *rules = this;
+                for (; index > 0; --index) {
+                    rules = rules->fNext;
+                }
+                return rules->fKeyword;
+            }
+            return UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+        }
         for (const RuleChain *rules = this; rules != NULL; rules = rules->fNext) {
              if (rules->ruleHeader->isFulfilled(number)) {
                  return rules->fKeyword;
@@ -261,12 +261,22 @@ public:
     UBool           fDecimalSamplesUnbounded;
     UBool           fIntegerSamplesUnbounded;
 
+    enum {
+        kIntegerTableSize = 1000,  // Integers 0..999 are looked up in fIntegerRuleIndexes.
+        kNoRuleIndex = 0xff        // No rule matches, the keyword is "other".
+    };
+    // For each integer below kIntegerTableSize, the index of the first rule
+    //   in the chain that it fulfills. Only set on the head of the chain,
+    //   by buildIntegerTable(); NULL otherwise.
+    uint8_t        *fIntegerRuleIndexes;
+
 
     RuleChain();
     RuleChain(const RuleChain& other);
     virtual ~RuleChain();
 
     UnicodeString select(const FixedDecimal &number) const;
+    void          buildIntegerTable(UErrorCode &status);
     void          dumpRules(UnicodeString& result);
     UErrorCode    getKeywords(int32_t maxArraySize, UnicodeString *keywords, int32_t& arraySize) const;
     UBool         isKeyword(const UnicodeString& keyword) const;
@@ -21,6 +21,13 @@ U_NAMESPACE_BEGIN
 
 static const int32_t gPower10[] = {1, 10, 100, 1000};
 
+static const int64_t gPower10Int64[] = {
+        1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL,
+        100000000LL, 1000000000LL, 10000000000LL, 100000000000LL,
+        1000000000000LL, 10000000000000LL, 100000000000000LL,
+        1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+        1000000000000000000LL};
+
 FixedPrecision::FixedPrecision() 
         : fExactOnly(FALSE), fFailIfOverMax(FALSE), fRoundingMode(DecimalFormat::kRoundHalfEven) {
     fMin.setIntDigitCount(1);
@@ -189,6 +196,13 @@ FixedPrecision::initVisibleDigits(
         digits.fAbsDoubleValueSet = U_SUCCESS(status) && !digits.isOverMaxDigits();
         return digits;
     }
+    // Round in int64 arithmetic
+    if (value > -1000000000000000000LL /* -1e18 */
+            && value < 1000000000000000000LL /* 1e18 */
+            && initRoundedVisibleDigits(
+                    value < 0 ? -value : value, 0, value < 0, digits, status)) {
+        return digits;
+    }
     // Oops have to use digit list
     DigitList digitList;
     digitList.set(value);
@@ -248,12 +262,148 @@ FixedPrecision::initVisibleDigits(
         return digits;
     }
 
+    // Integers below 1e15 have the same digits as a DigitList would hold,
+    // so they can be rounded as is. Larger ones keep only MAX_DBL_DIGITS.
+    if (n == 0 && scaled > -1e15 && scaled < 1e15
+            && initRoundedVisibleDigits(
+                    (int64_t) fabs(scaled), 0, uprv_isNegative(value), digits, status)) {
+        return digits;
+    }
+
+    // Round the digits that a DigitList would hold in int64 arithmetic
+    int64_t mantissa;
+    int32_t exponent;
+    if (DigitList::getDoubleCoefficient(value, mantissa, exponent)
+            && initRoundedVisibleDigits(
+                    mantissa, exponent, uprv_isNegative(value), digits, status)) {
+        return digits;
+    }
+
     // Oops have to use digit list
     DigitList digitList;
     digitList.set(value);
     return initVisibleDigits(digitList, digits, status);
 }
 
+UBool
+FixedPrecision::roundMantissa(
+        int64_t &mantissa,
+        int32_t &exponent,
+        UBool isNegative,
+        UBool &inexact) const {
+    inexact = FALSE;
+    int32_t maxSigDigits = fSignificant.getMax();
+    if (mantissa < 0 || mantissa >= gPower10Int64[18] || maxSigDigits < 1) {
+        return FALSE;
+    }
+    if (mantissa == 0) {
+        exponent = 0;
+        return TRUE;
+    }
+    // Same as DigitList::reduce()
+    while (mantissa % 10 == 0) {
+        mantissa /= 10;
+        ++exponent;
+    }
+    int32_t digitCount = 1;
+    while (digitCount < 18 && mantissa >= gPower10Int64[digitCount]) {
+        ++digitCount;
+    }
+    int32_t upperExponent = exponent + digitCount;
+
+    // Same exponent as DigitList::round() or DigitList::roundAtExponent()
+    int32_t roundExponent = fMax.getLeastSignificantInclusive();
+    if (maxSigDigits < digitCount
+            && (roundExponent == INT32_MIN || roundExponent < upperExponent - maxSigDigits)) {
+        roundExponent = upperExponent - maxSigDigits;
+    }
+    if (roundExponent > exponent) {
+        int32_t dropCount = roundExponent - exponent;
+        int64_t quotient = 0;
+        int64_t remainder = mantissa;
+        int32_t halfCompare = -1;  // remainder compared to half a unit
+        if (dropCount <= 18) {
+            quotient = mantissa / gPower10Int64[dropCount];
+            remainder = mantissa % gPower10Int64[dropCount];
+            int64_t half = gPower10Int64[dropCount] / 2;
+            halfCompare = remainder < half ? -1 : (remainder > half ? 1 : 0);
+        }
+        UBool roundUp;
+        switch (fRoundingMode) {
+        case DecimalFormat::kRoundCeiling:
+            roundUp = remainder != 0 && !isNegative;
+            break;
+        case DecimalFormat::kRoundFloor:
+            roundUp = remainder != 0 && isNegative;
+            break;
+        case DecimalFormat::kRoundDown:
+            roundUp = FALSE;
+            break;
+        case DecimalFormat::kRoundUp:
+            roundUp = remainder != 0;
+            break;
+        case DecimalFormat::kRoundHalfDown:
+            roundUp = halfCompare > 0;
+            break;
+        case DecimalFormat::kRoundHalfUp:
+            roundUp = halfCompare >= 0;
+            break;
+        default:
+            roundUp = halfCompare > 0 || (halfCompare == 0 && (quotient & 1) != 0);
+            break;
+        }
+        inexact = remainder != 0;
+        mantissa = roundUp ? quotient + 1 : quotient;
+        exponent = roundExponent;
+    }
+    if (mantissa == 0) {
+        exponent = 0;
+    }
+    for (; exponent > 0; --exponent) {
+        if (mantissa >= gPower10Int64[17]) {
+            return FALSE;
+        }
+        mantissa *= 10;
+    }
+    return TRUE;
+}
+
+UBool
+FixedPrecision::initRoundedVisibleDigits(
+        int64_t mantissa,
+        int32_t exponent,
+        UBool isNegative,
+        VisibleDigits &digits,
+        UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return TRUE;
+    }
+    UBool inexact;
+    if (!roundMantissa(mantissa, exponent, isNegative, inexact)) {
+        return FALSE;
+    }
+    if (inexact && fExactOnly) {
+        status = U_FORMAT_INEXACT_ERROR;
+        return TRUE;
+    }
+    if (!initVisibleDigits(isNegative ? -mantissa : mantissa, exponent, digits, status)) {
+        return FALSE;
+    }
+    // Both mantissa and 10^-exponent are exact doubles here, so their
+    // quotient is the correctly rounded value of the visible digits.
+    if (mantissa <= 9007199254740992LL /* 2^53 */
+            && -exponent < UPRV_LENGTHOF(gPower10Int64)
+            && U_SUCCESS(status) && !digits.isOverMaxDigits()) {
+        digits.fAbsDoubleValue =
+                (double) mantissa / (double) gPower10Int64[-exponent];
+        digits.fAbsDoubleValueSet = TRUE;
+    }
+    if (isNegative && mantissa == 0) {
+        digits.setNegative();
+    }
+    return TRUE;
+}
+
 UBool
 FixedPrecision::initVisibleDigits(
         int64_t mantissa,
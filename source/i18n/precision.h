@@ -226,6 +226,45 @@ private:
             int32_t exponent,
             VisibleDigits &digits,
             UErrorCode &status) const;
+    /**
+     * Rounds mantissa * 10^exponent in place the same way that round()
+     * rounds a DigitList when there is no rounding increment, but with
+     * int64 arithmetic only.
+     *
+     * @param mantissa the absolute value of the digits. On return, the
+     *  rounded digits.
+     * @param exponent on return, zero or negative.
+     * @param isNegative whether the value is negative, for directed
+     *  rounding modes.
+     * @param inexact set to TRUE if nonzero digits were rounded away.
+     * @return FALSE if the mantissa is too large for this; caller should
+     *  use a DigitList instead.
+     */
+    UBool roundMantissa(
+            int64_t &mantissa,
+            int32_t &exponent,
+            UBool isNegative,
+            UBool &inexact) const;
+
+    /**
+     * Like initVisibleDigits(mantissa, exponent, digits, status) but
+     * rounds first with roundMantissa() instead of giving up when
+     * rounding is required.
+     *
+     * @param mantissa the absolute value of the digits. May contain
+     *  trailing zeros.
+     * @param exponent may be positive, negative or zero.
+     * @param isNegative whether the value is negative. Zero may be negative.
+     * @param digits result stored here.
+     * @param status any error returned here.
+     * @return FALSE if caller must use a DigitList instead.
+     */
+    UBool initRoundedVisibleDigits(
+            int64_t mantissa,
+            int32_t exponent,
+            UBool isNegative,
+            VisibleDigits &digits,
+            UErrorCode &status) const;
     UBool isRoundingRequired(
             int32_t upperExponent, int32_t lowerExponent) const;
     DigitInterval &getIntervalForZero(DigitInterval &interval) const;
@@ -960,6 +960,38 @@ UCollationResult compareNFDIter(const Normalizer2Impl &nfcImpl,
     return UCOL_EQUAL;
 }
 
+/**
+ * Returns the index of the fast script table for the first differing characters,
+ * or -1 if the fast script path does not apply.
+ * One of them must be in a fast script block, and the other one must be
+ * in the same block, ASCII, or the end of its string (negative).
+ */
+int32_t
+getFastScriptTableIndex(UChar32 leftChar, UChar32 rightChar) {
+    int32_t i = CollationFastLatin::getScriptTableIndex(leftChar <= 0x7f ? rightChar : leftChar);
+    if(i >= 0 &&
+            (leftChar <= 0x7f || CollationFastLatin::getScriptTableIndex(leftChar) == i) &&
+            (rightChar <= 0x7f || CollationFastLatin::getScriptTableIndex(rightChar) == i)) {
+        return i;
+    }
+    return -1;
+}
+
+/**
+ * Maps a UTF-8 byte to a character for getFastScriptTableIndex():
+ * ASCII to itself, and a two-byte lead byte to the first character with that lead byte.
+ */
+inline UChar32
+getUTF8LeadChar(uint8_t b) {
+    if(b <= 0x7f) {
+        return b;
+    } else if(0xc0 <= b && b <= 0xdf) {
+        return (b & 0x1f) << 6;
+    } else {
+        return 0xffff;
+    }
+}
+
 }  // namespace
 
 UCollationResult
@@ -1041,6 +1073,29 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
         }
     } else {
         result = CollationFastLatin::BAIL_OUT_RESULT;
+        int32_t scriptIndex = getFastScriptTableIndex(
+            equalPrefixLength == leftLength ? -1 : left[equalPrefixLength],
+            equalPrefixLength == rightLength ? -1 : right[equalPrefixLength]);
+        const uint16_t *scriptTable;
+        int32_t scriptOptions;
+        if(scriptIndex >= 0 &&
+                (scriptTable = tailoring->getFastScriptTable(scriptIndex)) != NULL &&
+                (scriptOptions = CollationFastLatin::getScriptOptions(
+                    data, *settings, scriptTable, scriptIndex)) >= 0) {
+            if(leftLength >= 0) {
+                result = CollationFastLatin::compareScriptUTF16(scriptTable, scriptOptions,
+                                                                scriptIndex,
+                                                                left + equalPrefixLength,
+                                                                leftLength - equalPrefixLength,
+                                                                right + equalPrefixLength,
+                                                                rightLength - equalPrefixLength);
+            } else {
+                result = CollationFastLatin::compareScriptUTF16(scriptTable, scriptOptions,
+                                                                scriptIndex,
+                                                                left + equalPrefixLength, -1,
+                                                                right + equalPrefixLength, -1);
+            }
+        }
     }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
@@ -1170,6 +1225,29 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
         }
     } else {
         result = CollationFastLatin::BAIL_OUT_RESULT;
+        int32_t scriptIndex = getFastScriptTableIndex(
+            equalPrefixLength == leftLength ? -1 : getUTF8LeadChar(left[equalPrefixLength]),
+            equalPrefixLength == rightLength ? -1 : getUTF8LeadChar(right[equalPrefixLength]));
+        const uint16_t *scriptTable;
+        int32_t scriptOptions;
+        if(scriptIndex >= 0 &&
+                (scriptTable = tailoring->getFastScriptTable(scriptIndex)) != NULL &&
+                (scriptOptions = CollationFastLatin::getScriptOptions(
+                    data, *settings, scriptTable, scriptIndex)) >= 0) {
+            if(leftLength >= 0) {
+                result = CollationFastLatin::compareScriptUTF8(scriptTable, scriptOptions,
+                                                               scriptIndex,
+                                                               left + equalPrefixLength,
+                                                               leftLength - equalPrefixLength,
+                                                               right + equalPrefixLength,
+                                                               rightLength - equalPrefixLength);
+            } else {
+                result = CollationFastLatin::compareScriptUTF8(scriptTable, scriptOptions,
+                                                               scriptIndex,
+                                                               left + equalPrefixLength, -1,
+                                                               right + equalPrefixLength, -1);
+            }
+        }
     }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
@@ -1326,6 +1404,132 @@ RuleBasedCollator::getSortKey(const UChar *s, int32_t length,
     return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
 }
 
+namespace {
+
+/**
+ * getTruncatedSortKey() calls CollationKeys::writeSortKeyUpToQuaternary()
+ * with an instance of this callback class.
+ * It skips levels beyond the requested one, and all further levels
+ * once the sink is full.
+ */
+class TruncatedLevelCallback : public CollationKeys::LevelCallback {
+public:
+    TruncatedLevelCallback(const SortKeyByteSink &s, Collation::Level maxLevel)
+            : sink(s), lastLevel(maxLevel) {}
+    virtual ~TruncatedLevelCallback() {}
+    virtual UBool needToWrite(Collation::Level level) {
+        // The case level follows the secondary level.
+        return !sink.Overflowed() &&
+            (level <= lastLevel ||
+                (level == Collation::CASE_LEVEL && lastLevel >= Collation::SECONDARY_LEVEL));
+    }
+
+private:
+    const SortKeyByteSink &sink;
+    Collation::Level lastLevel;
+};
+
+}  // namespace
+
+int32_t
+RuleBasedCollator::getTruncatedSortKey(const UChar *s, int32_t length,
+                                       UColAttributeValue strength,
+                                       uint8_t *dest, int32_t capacity,
+                                       UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    Collation::Level maxLevel;
+    switch(strength) {
+    case UCOL_PRIMARY:
+        maxLevel = Collation::PRIMARY_LEVEL;
+        break;
+    case UCOL_SECONDARY:
+        maxLevel = Collation::SECONDARY_LEVEL;
+        break;
+    case UCOL_TERTIARY:
+        maxLevel = Collation::TERTIARY_LEVEL;
+        break;
+    case UCOL_QUATERNARY:
+        maxLevel = Collation::QUATERNARY_LEVEL;
+        break;
+    case UCOL_IDENTICAL:
+    case UCOL_DEFAULT:
+        maxLevel = Collation::IDENTICAL_LEVEL;
+        break;
+    default:
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(capacity == 0) { return 0; }
+
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    const UChar *limit = (length >= 0) ? s + length : NULL;
+    UBool numeric = settings->isNumeric();
+    TruncatedLevelCallback callback(sink, maxLevel);
+    // preflight=FALSE: Stop iterating when the primary level overflows the sink.
+    if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, FALSE, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, FALSE, errorCode);
+    }
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(!sink.Overflowed()) {
+        if(maxLevel == Collation::IDENTICAL_LEVEL && settings->getStrength() == UCOL_IDENTICAL) {
+            writeIdenticalLevel(s, limit, sink, errorCode);
+        }
+        static const char terminator = 0;  // TERMINATOR_BYTE
+        sink.Append(&terminator, 1);
+    }
+    int32_t keyLength = sink.NumberOfBytesAppended();
+    return keyLength < capacity ? keyLength : capacity;
+}
+
+CollationPrefixKey &
+CollationPrefixKey::set(const RuleBasedCollator &coll, const UChar *s, int32_t length,
+                        UErrorCode &errorCode) {
+    s_ = s;
+    length_ = length;
+    isComplete_ = TRUE;
+    prefix_ = 0;
+    uint8_t key[8];
+    int32_t keyLength = coll.getTruncatedSortKey(s, length, UCOL_PRIMARY,
+                                                 key, UPRV_LENGTHOF(key), errorCode);
+    if(U_FAILURE(errorCode)) { return *this; }
+    for(int32_t i = 0; i < UPRV_LENGTHOF(key); ++i) {
+        prefix_ = (prefix_ << 8) | (i < keyLength ? key[i] : 0);
+    }
+    // A complete key ends with the 00 terminator which occurs nowhere else.
+    isComplete_ = keyLength > 0 && key[keyLength - 1] == 0;
+    return *this;
+}
+
+UCollationResult
+RuleBasedCollator::comparePrefixKeys(const CollationPrefixKey &left,
+                                     const CollationPrefixKey &right,
+                                     UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if(left.prefix_ != right.prefix_) {
+        // Padding cannot tie with real bytes:
+        // A prefix can end with 00 bytes only if it is complete.
+        return left.prefix_ < right.prefix_ ? UCOL_LESS : UCOL_GREATER;
+    }
+    if(left.isComplete_ && settings->getStrength() == UCOL_PRIMARY &&
+            (settings->options & CollationSettings::CASE_LEVEL) == 0) {
+        // Equal primary weights, and no other levels.
+        return UCOL_EQUAL;
+    }
+    return compare(left.s_, left.length_, right.s_, right.length_, errorCode);
+}
+
 void
 RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
                                 SortKeyByteSink &sink, UErrorCode &errorCode) const {
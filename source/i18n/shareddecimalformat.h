@@ -0,0 +1,38 @@
+/*
+******************************************************************************
+* Copyright (C) 2016, International Business Machines
+* Corporation and others.  All Rights Reserved.
+******************************************************************************
+* shareddecimalformat.h
+*/
+
+#ifndef __SHARED_DECIMALFORMAT_H__
+#define __SHARED_DECIMALFORMAT_H__
+
+#include "unicode/utypes.h"
+#include "sharedobject.h"
+
+U_NAMESPACE_BEGIN
+
+class DecimalFormat;
+
+/**
+ * An immutable DecimalFormat shared through the UnifiedCache.
+ * See DecimalFormat::createSharedInstance().
+ */
+class U_I18N_API SharedDecimalFormat : public SharedObject {
+public:
+    SharedDecimalFormat(DecimalFormat *dfToAdopt) : ptr(dfToAdopt) { }
+    virtual ~SharedDecimalFormat();
+    const DecimalFormat *get() const { return ptr; }
+    const DecimalFormat *operator->() const { return ptr; }
+    const DecimalFormat &operator*() const { return *ptr; }
+private:
+    DecimalFormat *ptr;
+    SharedDecimalFormat(const SharedDecimalFormat &);
+    SharedDecimalFormat &operator=(const SharedDecimalFormat &);
+};
+
+U_NAMESPACE_END
+
+#endif
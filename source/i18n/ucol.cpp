@@ -206,6 +206,23 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getTruncatedSortKey(const UCollator *coll,
+                         const UChar *source, int32_t sourceLength,
+                         UColAttributeValue strength,
+                         uint8_t *dest, int32_t capacity,
+                         UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL && coll != NULL) {
+        *status = U_UNSUPPORTED_ERROR;
+        return 0;
+    }
+    return rbc->getTruncatedSortKey(source, sourceLength, strength, dest, capacity, *status);
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
@@ -0,0 +1,170 @@
+/*
+*******************************************************************************
+* Copyright (C) 2016, International Business Machines
+* Corporation and others.  All Rights Reserved.
+*******************************************************************************
+* ucol_sort.cpp
+*
+* created on: 2016jan25
+*
+* ucol_sortStrings(): Radix sort by truncated sort keys,
+* with full comparisons only among strings with equal key prefixes.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/tblcoll.h"
+#include "unicode/ucol.h"
+#include "cmemory.h"
+#include "uarrsort.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+/**
+ * Number of sort key bytes used for the radix sort.
+ * Typically enough to distinguish most strings by their primary weights.
+ */
+const int32_t PREFIX_LENGTH = 8;
+
+struct SortRecord {
+    /** Sort key prefix bytes in big-endian order, padded with 00 bytes. */
+    uint64_t prefix;
+    int32_t index;
+    /** TRUE if the prefix is the whole sort key. */
+    UBool isComplete;
+};
+
+struct SortContext {
+    const UCollator *coll;
+    const UChar *const *strings;
+    const int32_t *lengths;
+};
+
+int32_t U_CALLCONV
+compareRecords(const void *context, const void *left, const void *right) {
+    const SortContext *ctx = static_cast<const SortContext *>(context);
+    int32_t l = static_cast<const SortRecord *>(left)->index;
+    int32_t r = static_cast<const SortRecord *>(right)->index;
+    UCollationResult result = ucol_strcoll(
+        ctx->coll,
+        ctx->strings[l], ctx->lengths != NULL ? ctx->lengths[l] : -1,
+        ctx->strings[r], ctx->lengths != NULL ? ctx->lengths[r] : -1);
+    if(result != UCOL_EQUAL) { return result; }
+    // Equal strings keep their input order.
+    return l < r ? -1 : l > r ? 1 : 0;
+}
+
+/**
+ * Stable LSD radix sort by the prefix bytes.
+ * Skips byte positions where all records have the same byte.
+ * @return the array with the sorted records, either records or temp
+ */
+SortRecord *
+radixSort(SortRecord *records, SortRecord *temp, int32_t count) {
+    int32_t counts[PREFIX_LENGTH][256];
+    uprv_memset(counts, 0, sizeof(counts));
+    for(int32_t i = 0; i < count; ++i) {
+        uint64_t prefix = records[i].prefix;
+        for(int32_t b = 0; b < PREFIX_LENGTH; ++b) {
+            ++counts[b][(uint8_t)(prefix >> (8 * b))];
+        }
+    }
+    SortRecord *src = records;
+    SortRecord *dest = temp;
+    for(int32_t b = 0; b < PREFIX_LENGTH; ++b) {
+        int32_t *bucketCounts = counts[b];
+        if(bucketCounts[(uint8_t)(src[0].prefix >> (8 * b))] == count) {
+            continue;  // all records have the same byte here
+        }
+        int32_t start = 0;
+        for(int32_t j = 0; j < 256; ++j) {
+            int32_t n = bucketCounts[j];
+            bucketCounts[j] = start;
+            start += n;
+        }
+        for(int32_t i = 0; i < count; ++i) {
+            const SortRecord &r = src[i];
+            dest[bucketCounts[(uint8_t)(r.prefix >> (8 * b))]++] = r;
+        }
+        SortRecord *t = src;
+        src = dest;
+        dest = t;
+    }
+    return src;
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings, const int32_t *lengths, int32_t count,
+                 int32_t *permutation,
+                 UErrorCode *status) {
+    if(U_FAILURE(*status)) { return; }
+    if(coll == NULL || count < 0 || (count > 0 && (strings == NULL || permutation == NULL))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count == 0) { return; }
+    LocalMemory<SortRecord> records;
+    if(records.allocateInsteadAndReset(count) == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    LocalMemory<SortRecord> temp;
+    SortRecord *sorted = records.getAlias();
+    SortContext context = { coll, strings, lengths };
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        for(int32_t i = 0; i < count; ++i) {
+            records[i].index = i;
+        }
+        uprv_sortArray(sorted, count, (int32_t)sizeof(SortRecord),
+                       compareRecords, &context, FALSE, status);
+    } else {
+        for(int32_t i = 0; i < count; ++i) {
+            uint8_t key[PREFIX_LENGTH];
+            int32_t keyLength = rbc->getTruncatedSortKey(
+                strings[i], lengths != NULL ? lengths[i] : -1, UCOL_DEFAULT,
+                key, PREFIX_LENGTH, *status);
+            if(U_FAILURE(*status)) { return; }
+            uint64_t prefix = 0;
+            for(int32_t j = 0; j < PREFIX_LENGTH; ++j) {
+                prefix = (prefix << 8) | (j < keyLength ? key[j] : 0);
+            }
+            SortRecord &r = records[i];
+            r.prefix = prefix;
+            r.index = i;
+            // A complete key ends with the 00 terminator which occurs nowhere else.
+            r.isComplete = keyLength > 0 && key[keyLength - 1] == 0;
+        }
+        if(temp.allocateInsteadAndCopy(count, 0) == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        sorted = radixSort(records.getAlias(), temp.getAlias(), count);
+        // Equal complete keys mean equal strings, already in input order.
+        // Among equal incomplete prefixes, compare the strings.
+        // (An incomplete prefix cannot equal a complete one.)
+        for(int32_t start = 0; start < count;) {
+            int32_t limit = start + 1;
+            while(limit < count && sorted[limit].prefix == sorted[start].prefix) { ++limit; }
+            if((limit - start) > 1 && !sorted[start].isComplete) {
+                uprv_sortArray(sorted + start, limit - start, (int32_t)sizeof(SortRecord),
+                               compareRecords, &context, FALSE, status);
+                if(U_FAILURE(*status)) { return; }
+            }
+            start = limit;
+        }
+    }
+    if(U_FAILURE(*status)) { return; }
+    for(int32_t i = 0; i < count; ++i) {
+        permutation[i] = sorted[i].index;
+    }
+}
+
+#endif  // !UCONFIG_NO_COLLATION
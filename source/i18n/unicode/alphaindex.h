@@ -268,6 +268,28 @@ public:
          */
         int32_t getBucketIndex(const UnicodeString &name, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+        /**
+         * Finds the index buckets for many names at once.
+         * Equivalent to calling getBucketIndex() for each name, but faster:
+         * Each name's primary sort key prefix is computed only as far as needed
+         * and binary-searched among precomputed sort keys of the bucket boundaries.
+         *
+         * Like all of the ImmutableIndex functions, this is thread-safe.
+         * For very large inputs, the caller can split the array
+         * and call this function concurrently on the parts.
+         *
+         * @param names array of strings to be sorted into index buckets
+         * @param count number of names
+         * @param bucketIndexes output array of count bucket numbers
+         * @param errorCode ICU error code in/out parameter.
+         *                  Must fulfill U_SUCCESS before the function call.
+         * @draft ICU 57
+         */
+        void getBucketIndexes(const UnicodeString *names, int32_t count,
+                              int32_t *bucketIndexes, UErrorCode &errorCode) const;
+#endif  /* U_HIDE_DRAFT_API */
+
         /**
          * Returns the index-th bucket. Returns NULL if the index is out of range.
          *
@@ -287,6 +309,99 @@ public:
         Collator *collatorPrimaryOnly_;
     };
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Immutable, thread-safe index of records for collation-prefix lookups,
+     * for example for autocompletion.
+     * The records are sorted by their primary-strength sort keys
+     * (ties are broken by the full collator, then by the order in which they were added).
+     * A record matches a prefix string if its name starts with a string
+     * that is primary-equal to the prefix: "res" matches "R\u00E9sum\u00E9".
+     * The matching records form one contiguous range in this order,
+     * which getPrefixRanges() finds with binary searches.
+     *
+     * If the prefix ends with the beginning of a contraction
+     * (like "c" in Slovak, where "ch" sorts as a letter between "h" and "i"),
+     * then names that continue the contraction also match,
+     * which yields additional ranges.
+     *
+     * The PrefixIndex class is not intended for public subclassing.
+     *
+     * @draft ICU 57
+     */
+    class U_I18N_API PrefixIndex : public UObject {
+    public:
+        /**
+         * Destructor.
+         * @draft ICU 57
+         */
+        virtual ~PrefixIndex();
+
+        /**
+         * Returns the number of records.
+         *
+         * @return the number of records
+         * @draft ICU 57
+         */
+        int32_t getRecordCount() const;
+
+        /**
+         * Returns the name of the index-th record in sort key order.
+         * Returns NULL if the index is out of range.
+         *
+         * @param index record number
+         * @return the index-th record's name
+         * @draft ICU 57
+         */
+        const UnicodeString *getRecordName(int32_t index) const;
+
+        /**
+         * Returns the data of the index-th record in sort key order.
+         * Returns NULL if the index is out of range.
+         *
+         * @param index record number
+         * @return the index-th record's data pointer
+         * @draft ICU 57
+         */
+        const void *getRecordData(int32_t index) const;
+
+        /**
+         * Finds the records whose names match the prefix.
+         * Writes pairs of [start, limit[ record numbers for non-empty, non-overlapping ranges
+         * in ascending order.
+         * Usually there is at most one range; there can be more
+         * if the prefix ends with the beginning of a contraction.
+         * A prefix without primary weights (for example, the empty string)
+         * matches all records.
+         *
+         * @param prefix the prefix string
+         * @param ranges output array for 2*capacity record numbers;
+         *               can be NULL if capacity==0
+         * @param capacity the number of ranges that fit into the ranges array
+         * @param errorCode ICU error code in/out parameter.
+         *                  Set to U_BUFFER_OVERFLOW_ERROR if there are more than capacity ranges.
+         * @return the number of ranges
+         * @draft ICU 57
+         */
+        int32_t getPrefixRanges(const UnicodeString &prefix,
+                                int32_t *ranges, int32_t capacity,
+                                UErrorCode &errorCode) const;
+
+    private:
+        friend class AlphabeticIndex;
+
+        PrefixIndex(UVector *records, Collator *collatorPrimaryOnly,
+                    UVector *contractions, int32_t maxContractionLength)
+                : records_(records), collatorPrimaryOnly_(collatorPrimaryOnly),
+                  contractions_(contractions), maxContractionLength_(maxContractionLength) {}
+
+        UVector *records_;       // Sorted by primary sort keys.
+        Collator *collatorPrimaryOnly_;
+        UVector *contractions_;  // Contraction strings in code unit order.
+        int32_t maxContractionLength_;
+    };
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Construct an AlphabeticIndex object for the specified locale.  If the locale's
      * data does not include index characters, a set of them will be
@@ -358,6 +473,19 @@ public:
      */
     ImmutableIndex *buildImmutableIndex(UErrorCode &errorCode);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Builds an immutable, thread-safe index of the current records
+     * for collation-prefix lookups.
+     * Records added or removed afterwards do not affect the PrefixIndex.
+     * The caller owns the returned object.
+     *
+     * @return a new PrefixIndex
+     * @draft ICU 57
+     */
+    PrefixIndex *buildPrefixIndex(UErrorCode &errorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Get the Collator that establishes the ordering of the items in this index.
      * Ownership of the collator remains with the AlphabeticIndex instance.
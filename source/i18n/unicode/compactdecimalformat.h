@@ -26,6 +26,7 @@ struct UHashtable;
 U_NAMESPACE_BEGIN
 
 class PluralRules;
+struct CDFUnit;
 
 /**
  * The CompactDecimalFormat produces abbreviated numbers, suitable for display in
@@ -396,11 +397,12 @@ public:
 private:
 
     const UHashtable* _unitsByVariant;
+    const CDFUnit* const* _unitsByPlural;
     const double* _divisors;
     PluralRules* _pluralRules;
 
     // Default constructor not implemented.
-    CompactDecimalFormat(const DecimalFormat &, const UHashtable* unitsByVariant, const double* divisors, PluralRules* pluralRules);
+    CompactDecimalFormat(const DecimalFormat &, const UHashtable* unitsByVariant, const CDFUnit* const* unitsByPlural, const double* divisors, PluralRules* pluralRules);
 
     UBool eqHelper(const CompactDecimalFormat& that) const;
 };
@@ -64,6 +64,7 @@ class FixedDecimal;
 class DecimalFormatImpl;
 class PluralRules;
 class VisibleDigitsWithExponent;
+class SharedDecimalFormat;
 
 // explicit template instantiation. see digitlst.h
 #if defined (_MSC_VER)
@@ -779,6 +780,19 @@ public:
     void setParseAllInput(UNumberFormatAttributeValue value);
 #endif
 
+    /**
+     * ICU use only.
+     * Returns handle to a shared, cached, immutable copy of the given
+     * DecimalFormat. Formats that compare equal share one instance, so
+     * getting it again for the same configuration only adds a reference.
+     * The shared copy may be used for concurrent calls to const methods
+     * without cloning. On success, caller must call removeRef() on
+     * returned value once it is done with the shared instance.
+     * @internal
+     */
+    static const SharedDecimalFormat* U_EXPORT2 createSharedInstance(
+            const DecimalFormat &format, UErrorCode &status);
+
 #endif  /* U_HIDE_INTERNAL_API */
 
 
@@ -1170,6 +1184,126 @@ public:
                                   FieldPosition& pos,
                                   UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats an int64 number into a caller-provided UTF-16 buffer.
+     * Produces the same text as format(number, appendTo, pos).
+     *
+     * The result is written directly into dest.
+     * When the result fits, no heap memory is allocated,
+     * so this can be used on latency-critical threads.
+     * Otherwise the usual ICU preflighting convention applies.
+     *
+     * @param number        The value to be formatted.
+     * @param dest          Destination buffer; can be NULL if destCapacity==0.
+     * @param destCapacity  Number of UChars available at dest.
+     * @param status        Output param filled with success/failure status.
+     *                      Set to U_BUFFER_OVERFLOW_ERROR if the result does not fit.
+     * @return              The length of the result, not counting a terminating NUL.
+     * @draft ICU 57
+     */
+    int32_t format(int64_t number, UChar *dest, int32_t destCapacity,
+                   UErrorCode &status) const;
+
+    /**
+     * Formats a double number into a caller-provided UTF-16 buffer.
+     * Produces the same text as format(number, appendTo, pos).
+     * See the int64_t version for details.
+     *
+     * @param number        The value to be formatted.
+     * @param dest          Destination buffer; can be NULL if destCapacity==0.
+     * @param destCapacity  Number of UChars available at dest.
+     * @param status        Output param filled with success/failure status.
+     *                      Set to U_BUFFER_OVERFLOW_ERROR if the result does not fit.
+     * @return              The length of the result, not counting a terminating NUL.
+     * @draft ICU 57
+     */
+    int32_t format(double number, UChar *dest, int32_t destCapacity,
+                   UErrorCode &status) const;
+
+    /**
+     * Formats an int64 number into a caller-provided UTF-8 buffer.
+     * Produces the same text as format(number, appendTo, pos), converted to UTF-8.
+     *
+     * The number is formatted into stack scratch space and converted into dest.
+     * When the result fits, no heap memory is allocated,
+     * so this can be used on latency-critical threads.
+     * Otherwise the usual ICU preflighting convention applies.
+     *
+     * @param number        The value to be formatted.
+     * @param dest          Destination buffer; can be NULL if destCapacity==0.
+     * @param destCapacity  Number of bytes available at dest.
+     * @param status        Output param filled with success/failure status.
+     *                      Set to U_BUFFER_OVERFLOW_ERROR if the result does not fit.
+     * @return              The length of the result in bytes, not counting a terminating NUL.
+     * @draft ICU 57
+     */
+    int32_t formatUTF8(int64_t number, char *dest, int32_t destCapacity,
+                       UErrorCode &status) const;
+
+    /**
+     * Formats a double number into a caller-provided UTF-8 buffer.
+     * Produces the same text as format(number, appendTo, pos), converted to UTF-8.
+     * See the int64_t version for details.
+     *
+     * @param number        The value to be formatted.
+     * @param dest          Destination buffer; can be NULL if destCapacity==0.
+     * @param destCapacity  Number of bytes available at dest.
+     * @param status        Output param filled with success/failure status.
+     *                      Set to U_BUFFER_OVERFLOW_ERROR if the result does not fit.
+     * @return              The length of the result in bytes, not counting a terminating NUL.
+     * @draft ICU 57
+     */
+    int32_t formatUTF8(double number, char *dest, int32_t destCapacity,
+                       UErrorCode &status) const;
+
+    /**
+     * Formats an array of int64 numbers, appending the results one after the
+     * other without separators. Setup work that does not depend on the values
+     * is done once for the whole array, and integers whose format needs neither
+     * fraction digits nor padding use a fast integer digit generator.
+     * Produces the same text as formatting each number on its own.
+     *
+     * @param numbers   The values to be formatted.
+     * @param count     The number of values.
+     * @param appendTo  Output parameter to receive the results.
+     *                  Results are appended to existing contents.
+     * @param offsets   If not NULL, must have room for count+1 values.
+     *                  On output, offsets[i] is the index in appendTo of the
+     *                  start of the i-th result, and offsets[count] is the
+     *                  length of appendTo.
+     * @param status    Output param filled with success/failure status.
+     * @return          Reference to 'appendTo' parameter.
+     * @draft ICU 57
+     */
+    UnicodeString &format(const int64_t *numbers, int32_t count,
+                          UnicodeString &appendTo, int32_t *offsets,
+                          UErrorCode &status) const;
+
+    /**
+     * Formats an array of double numbers, appending the results one after the
+     * other without separators. Setup work that does not depend on the values
+     * is done once for the whole array, and integral values use the same
+     * fast integer path as the int64 version.
+     * Produces the same text as formatting each number on its own.
+     *
+     * @param numbers   The values to be formatted.
+     * @param count     The number of values.
+     * @param appendTo  Output parameter to receive the results.
+     *                  Results are appended to existing contents.
+     * @param offsets   If not NULL, must have room for count+1 values.
+     *                  On output, offsets[i] is the index in appendTo of the
+     *                  start of the i-th result, and offsets[count] is the
+     *                  length of appendTo.
+     * @param status    Output param filled with success/failure status.
+     * @return          Reference to 'appendTo' parameter.
+     * @draft ICU 57
+     */
+    UnicodeString &format(const double *numbers, int32_t count,
+                          UnicodeString &appendTo, int32_t *offsets,
+                          UErrorCode &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
    using NumberFormat::parse;
 
    /**
@@ -2250,14 +2384,6 @@ private:
 	
 protected:
 
-#ifndef U_HIDE_INTERNAL_API
-    /**
-     * Rounds a value according to the rules of this object.
-     * @internal
-     */
-    DigitList& _round(const DigitList& number, DigitList& adjustedNum, UBool& isNegative, UErrorCode& status) const;
-#endif  /* U_HIDE_INTERNAL_API */
-
     /**
      * Returns the currency in effect for this formatter.  Subclasses
      * should override this method as needed.  Unlike getCurrency(),
@@ -88,6 +88,96 @@ class SortKeyByteSink;
 class UnicodeSet;
 class UnicodeString;
 class UVector64;
+class RuleBasedCollator;
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A lightweight comparison key for a string:
+ * The first 8 bytes of its primary sort key, plus a reference to the string itself.
+ * Comparing two of these with RuleBasedCollator::comparePrefixKeys()
+ * is an integer comparison unless the strings have the same primary weight prefix,
+ * in which case it falls back to a full string comparison.
+ *
+ * This is useful for sorting with repeated comparisons of the same strings,
+ * at a fraction of the memory of full sort keys.
+ * For example, with std::sort():
+ * \code
+ * struct PrefixKeyLess {
+ *     const RuleBasedCollator &coll;
+ *     bool operator()(const CollationPrefixKey &a, const CollationPrefixKey &b) const {
+ *         UErrorCode errorCode = U_ZERO_ERROR;
+ *         return coll.comparePrefixKeys(a, b, errorCode) == UCOL_LESS;
+ *     }
+ * };
+ * \endcode
+ *
+ * The key does not copy the string: The string must remain valid and unchanged
+ * while the key is used.
+ * Keys must only be compared with the collator that they were set with,
+ * and only while its attributes are unchanged.
+ * @draft ICU 57
+ */
+class U_I18N_API CollationPrefixKey : public UMemory {
+public:
+    /**
+     * Default constructor. Creates a key for the empty string,
+     * which can then be set().
+     * @draft ICU 57
+     */
+    CollationPrefixKey() : s_(NULL), length_(0), isComplete_(TRUE), prefix_(0) {}
+
+    /**
+     * Constructor. Sets the key for the string.
+     * @param coll the collator
+     * @param s the string; not copied
+     * @param length the string length, or -1 if it is NUL-terminated
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @draft ICU 57
+     */
+    CollationPrefixKey(const RuleBasedCollator &coll, const UChar *s, int32_t length,
+                       UErrorCode &errorCode)
+            : s_(NULL), length_(0), isComplete_(TRUE), prefix_(0) {
+        set(coll, s, length, errorCode);
+    }
+
+    /**
+     * Sets the key for the string.
+     * @param coll the collator
+     * @param s the string; not copied
+     * @param length the string length, or -1 if it is NUL-terminated
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return *this
+     * @draft ICU 57
+     */
+    CollationPrefixKey &set(const RuleBasedCollator &coll, const UChar *s, int32_t length,
+                            UErrorCode &errorCode);
+
+    /**
+     * @return the string that this key was set for
+     * @draft ICU 57
+     */
+    const UChar *getString() const { return s_; }
+
+    /**
+     * @return the length of the string that this key was set for,
+     *         or -1 if it is NUL-terminated
+     * @draft ICU 57
+     */
+    int32_t getLength() const { return length_; }
+
+private:
+    friend class RuleBasedCollator;
+
+    const UChar *s_;
+    int32_t length_;
+    /** TRUE if prefix_ contains the whole primary sort key. */
+    UBool isComplete_;
+    /** Primary sort key bytes in big-endian order, padded with 00 bytes. */
+    uint64_t prefix_;
+};
+#endif  /* U_HIDE_DRAFT_API */
 
 /**
  * The RuleBasedCollator class provides the implementation of
@@ -647,6 +737,71 @@ public:
     virtual int32_t getSortKey(const UChar *source, int32_t sourceLength,
                                uint8_t *result, int32_t resultLength) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes a sort key prefix of at most capacity bytes,
+     * optionally limited to fewer levels than this collator's strength.
+     * Unlike getSortKey(), this does not calculate the full sort key length:
+     * Collation element iteration stops as soon as the primary level
+     * fills the buffer, which makes this suitable for compact keys
+     * such as B-tree index separators.
+     *
+     * The result is the sort key that this collator would return with
+     * the given strength, truncated to capacity bytes.
+     * (Exception: If the case level is on, then it is only written
+     * for UCOL_SECONDARY and higher strengths because it follows
+     * the secondary level in the sort key.)
+     * A complete sort key ends with a 00 terminator byte which does not
+     * occur anywhere else in a sort key; a truncated one does not.
+     *
+     * Ordering guarantee: Truncated keys compared bytewise (with a proper prefix
+     * sorting before a longer key, as with memcmp plus length) are in
+     * the same order as the strings, except that strings that differ only
+     * beyond the truncation compare equal.
+     * That is, key(a)<key(b) implies truncatedKey(a)<=truncatedKey(b),
+     * and truncatedKey(a)<truncatedKey(b) implies a<b.
+     * Strings with equal truncated keys must be compared with compare()
+     * or with their full sort keys.
+     *
+     * @param source string to be processed.
+     * @param sourceLength length of string to be processed. If -1, the string
+     *        is 0 terminated and length will be decided by the function.
+     * @param strength the maximum strength (levels) for the key, UCOL_PRIMARY..UCOL_IDENTICAL;
+     *        if it is greater than this collator's strength, or UCOL_DEFAULT,
+     *        then this collator's strength is used.
+     * @param dest buffer for the sort key prefix
+     * @param capacity the number of bytes available at dest
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return the number of bytes written, at most capacity
+     * @draft ICU 57
+     */
+    int32_t getTruncatedSortKey(const UChar *source, int32_t sourceLength,
+                                UColAttributeValue strength,
+                                uint8_t *dest, int32_t capacity,
+                                UErrorCode &errorCode) const;
+
+    /**
+     * Compares the strings of two prefix keys.
+     * If their primary weight prefixes differ, then this is decided
+     * without looking at the strings again.
+     * Otherwise the result is the same as from compare() on the strings.
+     *
+     * Both keys must have been set with this collator,
+     * and its attributes must not have changed since.
+     * @param left the first key
+     * @param right the second key
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @return UCOL_LESS, UCOL_EQUAL or UCOL_GREATER
+     * @see CollationPrefixKey
+     * @draft ICU 57
+     */
+    UCollationResult comparePrefixKeys(const CollationPrefixKey &left,
+                                       const CollationPrefixKey &right,
+                                       UErrorCode &errorCode) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Retrieves the reordering codes for this collator.
      * @param dest The array to fill with the script ordering.
@@ -1008,6 +1008,71 @@ ucol_getSortKey(const    UCollator    *coll,
         uint8_t        *result,
         int32_t        resultLength);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Writes a sort key prefix of at most capacity bytes,
+ * optionally limited to fewer levels than the collator's strength.
+ * Collation element iteration stops as soon as the primary level
+ * fills the buffer; the full sort key length is not calculated.
+ * Useful for compact keys such as B-tree index separators.
+ *
+ * A complete sort key ends with a 00 terminator byte, a truncated one does not.
+ * Truncated keys compared bytewise never order two strings
+ * differently from ucol_strcoll() (with the given strength),
+ * but strings that differ only beyond the truncation get equal keys.
+ * See icu::RuleBasedCollator::getTruncatedSortKey() for details.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The string to transform.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param strength The maximum strength for the key, UCOL_PRIMARY..UCOL_IDENTICAL,
+ *                 or UCOL_DEFAULT for the collator's strength.
+ * @param dest A pointer to a buffer to receive the sort key prefix.
+ * @param capacity The maximum number of bytes to write.
+ * @param status error code indicator.
+ *               Set to U_UNSUPPORTED_ERROR if coll is not rule-based.
+ * @return The number of bytes written, at most capacity.
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getTruncatedSortKey(const UCollator *coll,
+                         const UChar *source, int32_t sourceLength,
+                         UColAttributeValue strength,
+                         uint8_t *dest, int32_t capacity,
+                         UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Sorts an array of strings according to the collator and returns
+ * a permutation rather than moving the strings.
+ * On output, permutation[i] is the index of the i-th string in collation order.
+ * The sort is stable: Strings that compare equal keep their input order.
+ *
+ * This is much faster than sorting with ucol_strcoll() as the comparison
+ * function and uses much less memory than sorting full sort keys:
+ * The strings are radix-sorted by short, fixed-width sort key prefixes
+ * (see ucol_getTruncatedSortKey()), and only strings with equal prefixes
+ * are compared with ucol_strcoll().
+ * If coll is not rule-based, then all comparisons use ucol_strcoll().
+ *
+ * @param coll The collator.
+ * @param strings Array of count pointers to the strings.
+ * @param lengths Array of count string lengths, or NULL if all strings
+ *                are NUL-terminated. An individual length can be -1
+ *                for a NUL-terminated string.
+ * @param count The number of strings.
+ * @param permutation Output array of count indexes.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings, const int32_t *lengths, int32_t count,
+                 int32_t *permutation,
+                 UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
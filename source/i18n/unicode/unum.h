@@ -540,6 +540,76 @@ unum_formatDouble(    const    UNumberFormat*  fmt,
             UFieldPosition  *pos, /* 0 if ignore */
             UErrorCode*     status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Format an array of int64 values using a UNumberFormat.
+* The results are concatenated without separators into one buffer,
+* and offsets records where each one starts.
+* The output is the same as formatting each value with unum_formatInt64().
+* For a DecimalFormat, this is faster than separate calls because
+* the setup is done once for the whole array.
+* @param fmt The formatter to use.
+* @param numbers The numbers to format.
+* @param count The number of values.
+* @param result A pointer to a buffer to receive the NULL-terminated concatenated results. If
+* the results fit into dest but cannot be NULL-terminated (length == resultLength)
+* then the error code is set to U_STRING_NOT_TERMINATED_WARNING. If the results
+* do not fit into result then the error code is set to U_BUFFER_OVERFLOW_ERROR.
+* @param resultLength The maximum size of result.
+* @param offsets If not NULL, must have room for count+1 values.
+* On output, offsets[i] is the start index of the i-th result,
+* and offsets[count] is the total length. The offsets are set even
+* if the results do not fit into result.
+* @param status A pointer to an UErrorCode to receive any errors
+* @return The total buffer size needed; if greater than resultLength, the output was truncated.
+* @see unum_formatInt64
+* @see unum_formatDoubleArray
+* @draft ICU 57
+*/
+U_DRAFT int32_t U_EXPORT2
+unum_formatInt64Array(const UNumberFormat *fmt,
+            const int64_t *numbers,
+            int32_t         count,
+            UChar*          result,
+            int32_t         resultLength,
+            int32_t         *offsets,
+            UErrorCode*     status);
+
+/**
+* Format an array of double values using a UNumberFormat.
+* The results are concatenated without separators into one buffer,
+* and offsets records where each one starts.
+* The output is the same as formatting each value with unum_formatDouble().
+* For a DecimalFormat, this is faster than separate calls because
+* the setup is done once for the whole array.
+* @param fmt The formatter to use.
+* @param numbers The numbers to format.
+* @param count The number of values.
+* @param result A pointer to a buffer to receive the NULL-terminated concatenated results. If
+* the results fit into dest but cannot be NULL-terminated (length == resultLength)
+* then the error code is set to U_STRING_NOT_TERMINATED_WARNING. If the results
+* do not fit into result then the error code is set to U_BUFFER_OVERFLOW_ERROR.
+* @param resultLength The maximum size of result.
+* @param offsets If not NULL, must have room for count+1 values.
+* On output, offsets[i] is the start index of the i-th result,
+* and offsets[count] is the total length. The offsets are set even
+* if the results do not fit into result.
+* @param status A pointer to an UErrorCode to receive any errors
+* @return The total buffer size needed; if greater than resultLength, the output was truncated.
+* @see unum_formatDouble
+* @see unum_formatInt64Array
+* @draft ICU 57
+*/
+U_DRAFT int32_t U_EXPORT2
+unum_formatDoubleArray(const UNumberFormat *fmt,
+            const double    *numbers,
+            int32_t         count,
+            UChar*          result,
+            int32_t         resultLength,
+            int32_t         *offsets,
+            UErrorCode*     status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
 * Format a decimal number using a UNumberFormat.
 * The number will be formatted according to the UNumberFormat's locale.
@@ -758,6 +758,123 @@ U_STABLE int32_t U_EXPORT2 usearch_previous(UStringSearch *strsrch,
 */
 U_STABLE void U_EXPORT2 usearch_reset(UStringSearch *strsrch);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Data structure for searching a text for many patterns at once.
+ * @draft ICU 57
+ */
+struct UMultiStringSearch;
+/**
+ * Data structure for searching a text for many patterns at once.
+ * @draft ICU 57
+ */
+typedef struct UMultiStringSearch UMultiStringSearch;
+
+/**
+ * One match found by usearch_findAllMulti().
+ * @draft ICU 57
+ */
+typedef struct UMultiStringSearchMatch {
+    /** Index of the matching pattern in the array passed to usearch_openMulti(). @draft ICU 57 */
+    int32_t patternIndex;
+    /** Start index of the match in the text. @draft ICU 57 */
+    int32_t start;
+    /** Limit index of the match in the text. @draft ICU 57 */
+    int32_t limit;
+} UMultiStringSearchMatch;
+
+/**
+ * Creates a search object for many patterns at once, using the collator
+ * for language-sensitive matching. For example, set the collator strength
+ * to UCOL_PRIMARY to ignore accents and case.
+ *
+ * The collation elements of all patterns are combined into one trie,
+ * and usearch_findAllMulti() iterates over the text's collation elements
+ * only once, rather than once per pattern as with one UStringSearch per pattern.
+ * Match boundaries are checked as with a UStringSearch with default attributes
+ * and no break iterator: A match must start and end on grapheme cluster boundaries
+ * and must not partially match expansions.
+ * Collation elements are compared exactly
+ * (USEARCH_ELEMENT_COMPARISON is USEARCH_STANDARD_ELEMENT_COMPARISON).
+ *
+ * The collator is not copied: It must not be closed or modified
+ * while the search object is in use.
+ * A pattern with no collation elements at the collator strength
+ * (for example, only ignorable characters) never matches.
+ *
+ * @param patterns array of patternCount pointers to the patterns
+ * @param patternLengths array of patternCount pattern lengths,
+ *                       or NULL if all patterns are NUL-terminated;
+ *                       an individual length can be -1 for a NUL-terminated pattern
+ * @param patternCount the number of patterns, at least 1
+ * @param collator the collator
+ * @param status for errors if any occur
+ * @return the new search object, or NULL if an error occurred
+ * @draft ICU 57
+ */
+U_DRAFT UMultiStringSearch * U_EXPORT2
+usearch_openMulti(const UChar *const *patterns, const int32_t *patternLengths,
+                  int32_t patternCount,
+                  const UCollator *collator,
+                  UErrorCode *status);
+
+/**
+ * Closes a multi-pattern search object.
+ * @param msearch the object to close; can be NULL
+ * @draft ICU 57
+ */
+U_DRAFT void U_EXPORT2
+usearch_closeMulti(UMultiStringSearch *msearch);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUMultiStringSearchPointer
+ * "Smart pointer" class, closes a UMultiStringSearch via usearch_closeMulti().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 57
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUMultiStringSearchPointer, UMultiStringSearch, usearch_closeMulti);
+
+U_NAMESPACE_END
+
+#endif
+
+/**
+ * Finds all matches of all patterns in the text.
+ * The matches are written in text order of their first collation elements
+ * (which is usually the order of their start indexes);
+ * matches that begin with the same collation element are ordered by their
+ * number of collation elements.
+ * Matches may overlap, both for different patterns and for the same pattern.
+ *
+ * The search object keeps per-text state, so a UMultiStringSearch
+ * must not be used concurrently in multiple threads.
+ *
+ * @param msearch the multi-pattern search object
+ * @param text the text to be searched
+ * @param textLength the text length, or -1 if it is NUL-terminated
+ * @param matches the output array; can be NULL if capacity==0
+ * @param capacity the number of UMultiStringSearchMatch items available at matches
+ * @param status for errors if any occur;
+ *               U_BUFFER_OVERFLOW_ERROR if there are more than capacity matches
+ * @return the total number of matches (even if it is greater than capacity)
+ * @draft ICU 57
+ */
+U_DRAFT int32_t U_EXPORT2
+usearch_findAllMulti(UMultiStringSearch *msearch,
+                     const UChar *text, int32_t textLength,
+                     UMultiStringSearchMatch *matches, int32_t capacity,
+                     UErrorCode *status);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Simple forward search for the pattern, starting at a specified index,
@@ -190,6 +190,15 @@ unum_formatInt64(const UNumberFormat* fmt,
     if(U_FAILURE(*status))
         return -1;
     
+    if(pos == NULL) {
+        // Without a field position, a DecimalFormat formats straight into the buffer.
+        // Subclasses such as CompactDecimalFormat override format().
+        const NumberFormat *nf = (const NumberFormat *)fmt;
+        if(nf->getDynamicClassID() == DecimalFormat::getStaticClassID()) {
+            return ((const DecimalFormat *)nf)->format(number, result, resultLength, *status);
+        }
+    }
+
     UnicodeString res;
     if(!(result==NULL && resultLength==0)) {
         // NULL destination for pure preflighting: empty dummy string
@@ -223,6 +232,15 @@ unum_formatDouble(    const    UNumberFormat*  fmt,
  
   if(U_FAILURE(*status)) return -1;
 
+  if(pos == NULL) {
+    // Without a field position, a DecimalFormat formats straight into the buffer.
+    // Subclasses such as CompactDecimalFormat override format().
+    const NumberFormat *nf = (const NumberFormat *)fmt;
+    if(nf->getDynamicClassID() == DecimalFormat::getStaticClassID()) {
+      return ((const DecimalFormat *)nf)->format(number, result, resultLength, *status);
+    }
+  }
+
   UnicodeString res;
   if(!(result==NULL && resultLength==0)) {
     // NULL destination for pure preflighting: empty dummy string
@@ -245,6 +263,74 @@ unum_formatDouble(    const    UNumberFormat*  fmt,
   return res.extract(result, resultLength, *status);
 }
 
+namespace {
+
+template<typename T>
+int32_t
+formatArray(const UNumberFormat *fmt,
+            const T *numbers,
+            int32_t count,
+            UChar *result,
+            int32_t resultLength,
+            int32_t *offsets,
+            UErrorCode *status) {
+    if(U_FAILURE(*status)) {
+        return -1;
+    }
+    if(count < 0 || (numbers == NULL && count > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return -1;
+    }
+
+    UnicodeString res;
+    if(!(result==NULL && resultLength==0)) {
+        // NULL destination for pure preflighting: empty dummy string
+        // otherwise, alias the destination buffer
+        res.setTo(result, 0, resultLength);
+    }
+
+    const NumberFormat *nf = reinterpret_cast<const NumberFormat *>(fmt);
+    const DecimalFormat *df = dynamic_cast<const DecimalFormat *>(nf);
+    if(df != NULL) {
+        df->format(numbers, count, res, offsets, *status);
+    } else {
+        FieldPosition fp(FieldPosition::DONT_CARE);
+        for(int32_t i = 0; i < count && U_SUCCESS(*status); ++i) {
+            if(offsets != NULL) {
+                offsets[i] = res.length();
+            }
+            nf->format(numbers[i], res, fp, *status);
+        }
+        if(offsets != NULL) {
+            offsets[count] = res.length();
+        }
+    }
+    return res.extract(result, resultLength, *status);
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+unum_formatInt64Array(const UNumberFormat *fmt,
+            const int64_t *numbers,
+            int32_t         count,
+            UChar*          result,
+            int32_t         resultLength,
+            int32_t         *offsets,
+            UErrorCode*     status) {
+    return formatArray(fmt, numbers, count, result, resultLength, offsets, status);
+}
+
+U_CAPI int32_t U_EXPORT2
+unum_formatDoubleArray(const UNumberFormat *fmt,
+            const double    *numbers,
+            int32_t         count,
+            UChar*          result,
+            int32_t         resultLength,
+            int32_t         *offsets,
+            UErrorCode*     status) {
+    return formatArray(fmt, numbers, count, result, resultLength, offsets, status);
+}
 
 U_CAPI int32_t U_EXPORT2 
 unum_formatDecimal(const    UNumberFormat*  fmt,
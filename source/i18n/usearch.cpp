@@ -20,6 +20,7 @@
 #include "cmemory.h"
 #include "ucln_in.h"
 #include "uassert.h"
+#include "uarrsort.h"
 #include "ustr_imp.h"
 
 U_NAMESPACE_USE
@@ -93,6 +94,17 @@ inline int hashFromCE32(uint32_t ce)
     return hc;
 }
 
+/**
+* Getting the hash value for a processed (64-bit) collation element.
+* @param pce processed collation element
+* @return hash code
+*/
+static
+inline int hashFromPCE(int64_t pce)
+{
+    return hashFromCE32((uint32_t)((uint64_t)pce >> 32) ^ (uint32_t)pce);
+}
+
 U_CDECL_BEGIN
 static UBool U_CALLCONV
 usearch_cleanup(void) {
@@ -420,6 +432,18 @@ inline uint16_t initializePatternPCETable(UStringSearch *strsrch,
     pattern->pces       = pcetable;
     pattern->pcesLength = offset;
 
+    // Horspool shifts for the text CE aligned with the last pattern CE:
+    // the distance from its last occurrence in the rest of the pattern
+    // to the end, or the pattern length if it does not occur.
+    // Colliding CEs share the smallest shift.
+    int32_t count;
+    for (count = 0; count < MAX_TABLE_SIZE_; count ++) {
+        pattern->pceShift[count] = offset;
+    }
+    for (count = 0; count + 1 < offset; count ++) {
+        pattern->pceShift[hashFromPCE(pcetable[count])] = offset - 1 - count;
+    }
+
     return result;
 }
 
@@ -1071,7 +1095,8 @@ inline UBool isOutOfBounds(int32_t textlength, int32_t offset)
 */
 static
 inline UBool checkIdentical(const UStringSearch *strsrch, int32_t start,
-                                  int32_t    end)
+                                  int32_t    end,
+                            const UChar *patText, int32_t patTextLength)
 {
     if (strsrch->strength != UCOL_IDENTICAL) {
         return TRUE;
@@ -1084,11 +1109,19 @@ inline UBool checkIdentical(const UStringSearch *strsrch, int32_t start,
     strsrch->nfd->normalize(
         UnicodeString(FALSE, strsrch->search->text + start, end - start), t2, status);
     strsrch->nfd->normalize(
-        UnicodeString(FALSE, strsrch->pattern.text, strsrch->pattern.textLength), p2, status);
+        UnicodeString(FALSE, patText, patTextLength), p2, status);
     // return FALSE if NFD failed
     return U_SUCCESS(status) && t2 == p2;
 }
 
+static
+inline UBool checkIdentical(const UStringSearch *strsrch, int32_t start,
+                                  int32_t    end)
+{
+    return checkIdentical(strsrch, start, end,
+                          strsrch->pattern.text, strsrch->pattern.textLength);
+}
+
 #if BOYER_MOORE
 /**
 * Checks to see if the match is repeated
@@ -3477,6 +3510,7 @@ struct CEIBuffer {
                ~CEIBuffer();
    const CEI   *get(int32_t index);
    const CEI   *getPrevious(int32_t index);
+   const CEI   *getAhead(int32_t index);
 };
 
 
@@ -3562,6 +3596,19 @@ const CEI *CEIBuffer::get(int32_t index) {
     return &buf[i];
 }
 
+// Get the CE with the specified index, fetching all of the CEs up to it
+//   that have not been fetched yet.
+//   Index must be greater than n-history_size,
+//   where n is the largest index to have been fetched so far.
+//   Used for skipping ahead over match starting positions that cannot match.
+//
+const CEI *CEIBuffer::getAhead(int32_t index) {
+    while (limitIx < index) {
+        get(limitIx);
+    }
+    return get(index);
+}
+
 // Get the CE with the specified index.
 //   Index must be in the range
 //          n-history_size < index < n+1
@@ -3831,6 +3878,121 @@ UChar32 codePointBefore(const USearch &search, int32_t index) {
 
 }  // namespace
 
+/*
+ * Checks the text bounds of a match that was found in CE space,
+ *   from the first and last matching target CEs and the one following them.
+ * @param maxLimit the match limit allowed by the CEs following the match
+ * @param mLimitPtr receives the match limit
+ * @return FALSE if the match is rejected
+ */
+static UBool checkMatchBounds(UStringSearch *strsrch,
+                              const CEI *firstCEI, const CEI *lastCEI, const CEI *nextCEI,
+                              int32_t maxLimit,
+                              const UChar *patText, int32_t patTextLength,
+                              int32_t *mLimitPtr)
+{
+    UBool   found    = TRUE;
+    int32_t mStart   = firstCEI->lowIndex;
+    int32_t minLimit = lastCEI->lowIndex;
+    int32_t mLimit;
+
+    // Check for the start of the match being within a combining sequence.
+    //   This can happen if the pattern itself begins with a combining char, and
+    //   the match found combining marks in the target text that were attached
+    //    to something else.
+    //   This type of match should be rejected for not completely consuming a
+    //   combining sequence.
+    if (!isBreakBoundary(strsrch, mStart)) {
+        found = FALSE;
+    }
+
+    // Check for the start of the match being within an Collation Element Expansion,
+    //   meaning that the first char of the match is only partially matched.
+    //   With exapnsions, the first CE will report the index of the source
+    //   character, and all subsequent (expansions) CEs will report the source index of the
+    //    _following_ character.
+    int32_t secondIx = firstCEI->highIndex;
+    if (mStart == secondIx) {
+        found = FALSE;
+    }
+
+    // Allow matches to end in the middle of a grapheme cluster if the following
+    // conditions are met; this is needed to make prefix search work properly in
+    // Indic, see #11750
+    // * the default breakIter is being used
+    // * the next collation element after this combining sequence
+    //   - has non-zero primary weight
+    //   - corresponds to a separate character following the one at end of the current match
+    //   (the second of these conditions, and perhaps both, may be redundant given the
+    //   subsequent check for normalization boundary; however they are likely much faster
+    //   tests in any case)
+    // * the match limit is a normalization boundary
+    UBool allowMidclusterMatch = FALSE;
+    if (strsrch->search->text != NULL && strsrch->search->textLength > maxLimit) {
+        allowMidclusterMatch =
+                strsrch->search->breakIter == NULL &&
+                nextCEI != NULL && (((nextCEI->ce) >> 32) & 0xFFFF0000UL) != 0 &&
+                maxLimit >= lastCEI->highIndex && nextCEI->highIndex > maxLimit &&
+                (strsrch->nfd->hasBoundaryBefore(codePointAt(*strsrch->search, maxLimit)) ||
+                    strsrch->nfd->hasBoundaryAfter(codePointBefore(*strsrch->search, maxLimit)));
+    }
+    // If those conditions are met, then:
+    // * do NOT advance the candidate match limit (mLimit) to a break boundary; however
+    //   the match limit may be backed off to a previous break boundary. This handles
+    //   cases in which mLimit includes target characters that are ignorable with current
+    //   settings (such as space) and which extend beyond the pattern match.
+    // * do NOT require that end of the combining sequence not extend beyond the match in CE space
+    // * do NOT require that match limit be on a breakIter boundary
+
+    //  Advance the match end position to the first acceptable match boundary.
+    //    This advances the index over any combining charcters.
+    mLimit = maxLimit;
+    if (minLimit < maxLimit) {
+        // When the last CE's low index is same with its high index, the CE is likely
+        // a part of expansion. In this case, the index is located just after the
+        // character corresponding to the CEs compared above. If the index is right
+        // at the break boundary, move the position to the next boundary will result
+        // incorrect match length when there are ignorable characters exist between
+        // the position and the next character produces CE(s). See ticket#8482.
+        if (minLimit == lastCEI->highIndex && isBreakBoundary(strsrch, minLimit)) {
+            mLimit = minLimit;
+        } else {
+            int32_t nba = nextBoundaryAfter(strsrch, minLimit);
+            // Note that we can have nba < maxLimit && nba >= minLImit, in which
+            // case we want to set mLimit to nba regardless of allowMidclusterMatch
+            // (i.e. we back off mLimit to the previous breakIterator boundary).
+            if (nba >= lastCEI->highIndex && (!allowMidclusterMatch || nba < maxLimit)) {
+                mLimit = nba;
+            }
+        }
+    }
+
+    #ifdef USEARCH_DEBUG
+    if (getenv("USEARCH_DEBUG") != NULL) {
+        printf("minLimit, maxLimit, mLimit = %d, %d, %d\n", minLimit, maxLimit, mLimit);
+    }
+    #endif
+
+    if (!allowMidclusterMatch) {
+        // If advancing to the end of a combining sequence in character indexing space
+        //   advanced us beyond the end of the match in CE space, reject this match.
+        if (mLimit > maxLimit) {
+            found = FALSE;
+        }
+
+        if (!isBreakBoundary(strsrch, mLimit)) {
+            found = FALSE;
+        }
+    }
+
+    if (! checkIdentical(strsrch, mStart, mLimit, patText, patTextLength)) {
+        found = FALSE;
+    }
+
+    *mLimitPtr = mLimit;
+    return found;
+}
+
 U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
                                        int32_t        startIdx,
                                        int32_t        *matchStart,
@@ -3879,9 +4041,14 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
 
     int32_t  mStart = -1;
     int32_t  mLimit = -1;
-    int32_t  minLimit;
     int32_t  maxLimit;
 
+    // With exact CE matching, a match at targetIx requires the target CE
+    //   at targetIx+lastPatIx to equal the last pattern CE, so starting positions
+    //   can be skipped according to that target CE (Boyer-Moore-Horspool).
+    //   Other comparison types can match varying numbers of target CEs.
+    const int32_t lastPatIx = strsrch->pattern.pcesLength - 1;
+    const UBool   skipAhead = strsrch->search->elementComparisonType == 0 && lastPatIx > 0;
 
 
     // Outer loop moves over match starting positions in the
@@ -3900,6 +4067,24 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     //
     for(targetIx=0; ; targetIx++)
     {
+        if (skipAhead) {
+            const CEI *alignedCEI;
+            for (;;) {
+                alignedCEI = ceb.getAhead(targetIx + lastPatIx);
+                if (alignedCEI == NULL ||
+                        alignedCEI->ce == strsrch->pattern.pces[lastPatIx] ||
+                        alignedCEI->ce == UCOL_PROCESSED_NULLORDER) {
+                    // Check this position; the match loop handles the end of input.
+                    break;
+                }
+                targetIx += strsrch->pattern.pceShift[hashFromPCE(alignedCEI->ce)];
+            }
+            if (alignedCEI == NULL) {
+                *status = U_INTERNAL_PROGRAM_ERROR;
+                found = FALSE;
+                break;
+            }
+        }
         found = TRUE;
         //  Inner loop checks for a match beginning at each
         //  position from the outer loop.
@@ -3957,7 +4142,6 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
         const CEI *lastCEI  = ceb.get(targetIx + targetIxOffset - 1);
 
         mStart   = firstCEI->lowIndex;
-        minLimit = lastCEI->lowIndex;
 
         // Look at the CE following the match.  If it is UCOL_NULLORDER the match
         //   extended to the end of input, and the match is good.
@@ -4004,96 +4188,8 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
         }
 
 
-        // Check for the start of the match being within a combining sequence.
-        //   This can happen if the pattern itself begins with a combining char, and
-        //   the match found combining marks in the target text that were attached
-        //    to something else.
-        //   This type of match should be rejected for not completely consuming a
-        //   combining sequence.
-        if (!isBreakBoundary(strsrch, mStart)) {
-            found = FALSE;
-        }
-
-        // Check for the start of the match being within an Collation Element Expansion,
-        //   meaning that the first char of the match is only partially matched.
-        //   With exapnsions, the first CE will report the index of the source
-        //   character, and all subsequent (expansions) CEs will report the source index of the
-        //    _following_ character.
-        int32_t secondIx = firstCEI->highIndex;
-        if (mStart == secondIx) {
-            found = FALSE;
-        }
-
-        // Allow matches to end in the middle of a grapheme cluster if the following
-        // conditions are met; this is needed to make prefix search work properly in
-        // Indic, see #11750
-        // * the default breakIter is being used
-        // * the next collation element after this combining sequence
-        //   - has non-zero primary weight
-        //   - corresponds to a separate character following the one at end of the current match
-        //   (the second of these conditions, and perhaps both, may be redundant given the
-        //   subsequent check for normalization boundary; however they are likely much faster
-        //   tests in any case)
-        // * the match limit is a normalization boundary
-        UBool allowMidclusterMatch = FALSE;
-        if (strsrch->search->text != NULL && strsrch->search->textLength > maxLimit) {
-            allowMidclusterMatch =
-                    strsrch->search->breakIter == NULL &&
-                    nextCEI != NULL && (((nextCEI->ce) >> 32) & 0xFFFF0000UL) != 0 &&
-                    maxLimit >= lastCEI->highIndex && nextCEI->highIndex > maxLimit &&
-                    (strsrch->nfd->hasBoundaryBefore(codePointAt(*strsrch->search, maxLimit)) ||
-                        strsrch->nfd->hasBoundaryAfter(codePointBefore(*strsrch->search, maxLimit)));
-        }
-        // If those conditions are met, then:
-        // * do NOT advance the candidate match limit (mLimit) to a break boundary; however
-        //   the match limit may be backed off to a previous break boundary. This handles
-        //   cases in which mLimit includes target characters that are ignorable with current
-        //   settings (such as space) and which extend beyond the pattern match.
-        // * do NOT require that end of the combining sequence not extend beyond the match in CE space
-        // * do NOT require that match limit be on a breakIter boundary
-
-        //  Advance the match end position to the first acceptable match boundary.
-        //    This advances the index over any combining charcters.
-        mLimit = maxLimit;
-        if (minLimit < maxLimit) {
-            // When the last CE's low index is same with its high index, the CE is likely
-            // a part of expansion. In this case, the index is located just after the
-            // character corresponding to the CEs compared above. If the index is right
-            // at the break boundary, move the position to the next boundary will result
-            // incorrect match length when there are ignorable characters exist between
-            // the position and the next character produces CE(s). See ticket#8482.
-            if (minLimit == lastCEI->highIndex && isBreakBoundary(strsrch, minLimit)) {
-                mLimit = minLimit;
-            } else {
-                int32_t nba = nextBoundaryAfter(strsrch, minLimit);
-                // Note that we can have nba < maxLimit && nba >= minLImit, in which
-                // case we want to set mLimit to nba regardless of allowMidclusterMatch
-                // (i.e. we back off mLimit to the previous breakIterator boundary).
-                if (nba >= lastCEI->highIndex && (!allowMidclusterMatch || nba < maxLimit)) {
-                    mLimit = nba;
-                }
-            }
-        }
-
-    #ifdef USEARCH_DEBUG
-        if (getenv("USEARCH_DEBUG") != NULL) {
-            printf("minLimit, maxLimit, mLimit = %d, %d, %d\n", minLimit, maxLimit, mLimit);
-        }
-    #endif
-
-        if (!allowMidclusterMatch) {
-            // If advancing to the end of a combining sequence in character indexing space
-            //   advanced us beyond the end of the match in CE space, reject this match.
-            if (mLimit > maxLimit) {
-                found = FALSE;
-            }
-
-            if (!isBreakBoundary(strsrch, mLimit)) {
-                found = FALSE;
-            }
-        }
-
-        if (! checkIdentical(strsrch, mStart, mLimit)) {
+        if (!checkMatchBounds(strsrch, firstCEI, lastCEI, nextCEI, maxLimit,
+                              strsrch->pattern.text, strsrch->pattern.textLength, &mLimit)) {
             found = FALSE;
         }
 
@@ -4943,4 +5039,296 @@ UBool usearch_handlePreviousCanonical(UStringSearch *strsrch,
 #endif
 }
 
+// multi-pattern search -------------------------------------------------
+
+struct UMultiStringSearch {
+    // Holds the text, the break iterator and the text CE iterator,
+    // and provides the match boundary checks. Its own pattern is not used.
+    UStringSearch *strsrch;
+    int32_t        patternCount;
+    // All patterns, concatenated; pattern i is at patternStarts[i]..patternStarts[i+1]-1.
+    UChar         *patternText;
+    int32_t       *patternStarts;
+    // The processed CEs of all patterns, concatenated; indexed via pceStarts[].
+    int64_t       *pces;
+    int32_t       *pceStarts;
+    // Pattern indexes sorted by their CE sequences. Together with pces[]
+    // this is a trie: The patterns that share the first n CEs form a contiguous range,
+    // with any pattern of exactly n CEs at its start.
+    int32_t       *order;
+    // All of the CEs of the current text.
+    CEI           *textCEs;
+    int32_t        textCEsCapacity;
+};
+
+namespace {
+
+int32_t U_CALLCONV
+comparePatternCEs(const void *context, const void *left, const void *right) {
+    const UMultiStringSearch *msearch = static_cast<const UMultiStringSearch *>(context);
+    int32_t l = *static_cast<const int32_t *>(left);
+    int32_t r = *static_cast<const int32_t *>(right);
+    const int64_t *lp = msearch->pces + msearch->pceStarts[l];
+    const int64_t *lLimit = msearch->pces + msearch->pceStarts[l + 1];
+    const int64_t *rp = msearch->pces + msearch->pceStarts[r];
+    const int64_t *rLimit = msearch->pces + msearch->pceStarts[r + 1];
+    for (;; ++lp, ++rp) {
+        if (lp == lLimit) {
+            return rp == rLimit ? 0 : -1;
+        } else if (rp == rLimit) {
+            return 1;
+        } else if (*lp != *rp) {
+            return (uint64_t)*lp < (uint64_t)*rp ? -1 : 1;
+        }
+    }
+}
+
+/**
+ * Within order[start..limit-1], where all patterns have more than depth CEs,
+ * finds the first one whose CE at depth is not less than (or, if upper, greater than) ce.
+ */
+int32_t findPatternCE(const UMultiStringSearch *msearch, int32_t start, int32_t limit,
+                      int32_t depth, uint64_t ce, UBool upper) {
+    while (start < limit) {
+        int32_t middle = (start + limit) / 2;
+        uint64_t middleCE = (uint64_t)msearch->pces[msearch->pceStarts[msearch->order[middle]] + depth];
+        if (middleCE < ce || (upper && middleCE == ce)) {
+            start = middle + 1;
+        } else {
+            limit = middle;
+        }
+    }
+    return start;
+}
+
+}  // namespace
+
+U_CAPI UMultiStringSearch * U_EXPORT2
+usearch_openMulti(const UChar *const *patterns, const int32_t *patternLengths,
+                  int32_t patternCount,
+                  const UCollator *collator,
+                  UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if (patterns == NULL || patternCount <= 0 || collator == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    int32_t totalLength = 0;
+    for (int32_t i = 0; i < patternCount; ++i) {
+        int32_t length = patternLengths != NULL ? patternLengths[i] : -1;
+        if (patterns[i] == NULL ? length != 0 : length < -1) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return NULL;
+        }
+        totalLength += length >= 0 ? length : u_strlen(patterns[i]);
+    }
+
+    UMultiStringSearch *msearch = (UMultiStringSearch *)uprv_malloc(sizeof(UMultiStringSearch));
+    if (msearch == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    uprv_memset(msearch, 0, sizeof(UMultiStringSearch));
+    msearch->patternCount  = patternCount;
+    msearch->patternText   = (UChar *)uprv_malloc((totalLength + 1) * sizeof(UChar));
+    msearch->patternStarts = (int32_t *)uprv_malloc((patternCount + 1) * sizeof(int32_t));
+    msearch->pceStarts     = (int32_t *)uprv_malloc((patternCount + 1) * sizeof(int32_t));
+    msearch->order         = (int32_t *)uprv_malloc(patternCount * sizeof(int32_t));
+    if (msearch->patternText == NULL || msearch->patternStarts == NULL ||
+            msearch->pceStarts == NULL || msearch->order == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        usearch_closeMulti(msearch);
+        return NULL;
+    }
+
+    // The pattern and text only initialize the internal search object;
+    // they are replaced for each search.
+    static const UChar space = 0x20;
+    msearch->strsrch = usearch_openFromCollator(&space, 1, &space, 1, collator, NULL, status);
+    if (U_FAILURE(*status)) {
+        usearch_closeMulti(msearch);
+        return NULL;
+    }
+
+    int32_t pcesCapacity = totalLength + patternCount;
+    msearch->pces = (int64_t *)uprv_malloc(pcesCapacity * sizeof(int64_t));
+    if (msearch->pces == NULL) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        usearch_closeMulti(msearch);
+        return NULL;
+    }
+    UCollationElements *coleiter = msearch->strsrch->textIter;
+    icu::UCollationPCE iter(coleiter);
+    int32_t textIndex = 0;
+    int32_t pcesLength = 0;
+    for (int32_t i = 0; i < patternCount; ++i) {
+        int32_t length = patternLengths != NULL ? patternLengths[i] : -1;
+        if (length < 0) {
+            length = u_strlen(patterns[i]);
+        }
+        UChar *patternText = msearch->patternText + textIndex;
+        if (length > 0) {
+            u_memcpy(patternText, patterns[i], length);
+        }
+        msearch->patternStarts[i] = textIndex;
+        msearch->pceStarts[i] = pcesLength;
+        msearch->order[i] = i;
+        textIndex += length;
+        if (length == 0) {
+            continue;
+        }
+        ucol_setText(coleiter, patternText, length, status);
+        iter.init(coleiter);
+        int64_t pce;
+        while ((pce = iter.nextProcessed(NULL, NULL, status)) != UCOL_PROCESSED_NULLORDER &&
+                U_SUCCESS(*status)) {
+            if (pcesLength == pcesCapacity) {
+                int32_t newCapacity = 2 * pcesCapacity;
+                int64_t *newPCEs = (int64_t *)uprv_realloc(msearch->pces, newCapacity * sizeof(int64_t));
+                if (newPCEs == NULL) {
+                    *status = U_MEMORY_ALLOCATION_ERROR;
+                    break;
+                }
+                msearch->pces = newPCEs;
+                pcesCapacity = newCapacity;
+            }
+            msearch->pces[pcesLength++] = pce;
+        }
+        if (U_FAILURE(*status)) {
+            usearch_closeMulti(msearch);
+            return NULL;
+        }
+    }
+    msearch->patternText[textIndex] = 0;
+    msearch->patternStarts[patternCount] = textIndex;
+    msearch->pceStarts[patternCount] = pcesLength;
+    uprv_sortArray(msearch->order, patternCount, (int32_t)sizeof(int32_t),
+                   comparePatternCEs, msearch, FALSE, status);
+    if (U_FAILURE(*status)) {
+        usearch_closeMulti(msearch);
+        return NULL;
+    }
+    return msearch;
+}
+
+U_CAPI void U_EXPORT2
+usearch_closeMulti(UMultiStringSearch *msearch)
+{
+    if (msearch != NULL) {
+        if (msearch->strsrch != NULL) {
+            usearch_close(msearch->strsrch);
+        }
+        uprv_free(msearch->patternText);
+        uprv_free(msearch->patternStarts);
+        uprv_free(msearch->pces);
+        uprv_free(msearch->pceStarts);
+        uprv_free(msearch->order);
+        uprv_free(msearch->textCEs);
+        uprv_free(msearch);
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+usearch_findAllMulti(UMultiStringSearch *msearch,
+                     const UChar *text, int32_t textLength,
+                     UMultiStringSearchMatch *matches, int32_t capacity,
+                     UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (msearch == NULL || (text == NULL && textLength != 0) || textLength < -1 ||
+            capacity < 0 || (matches == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (textLength < 0) {
+        textLength = u_strlen(text);
+    }
+    if (textLength == 0) {
+        return 0;
+    }
+    UStringSearch *strsrch = msearch->strsrch;
+    usearch_setText(strsrch, text, textLength, status);
+    if (!initTextProcessedIter(strsrch, status)) {
+        return 0;
+    }
+
+    // Iterate over the text's CEs once, keeping the terminating NULLORDER entry
+    // for the checks of matches at the end of the text.
+    int32_t textCEsLength = 0;
+    for (;;) {
+        if (textCEsLength == msearch->textCEsCapacity) {
+            int32_t newCapacity = textCEsLength < 64 ? 128 : 2 * textCEsLength;
+            CEI *newCEs = (CEI *)uprv_realloc(msearch->textCEs, newCapacity * sizeof(CEI));
+            if (newCEs == NULL) {
+                *status = U_MEMORY_ALLOCATION_ERROR;
+                return 0;
+            }
+            msearch->textCEs = newCEs;
+            msearch->textCEsCapacity = newCapacity;
+        }
+        CEI &cei = msearch->textCEs[textCEsLength];
+        cei.ce = strsrch->textProcessedIter->nextProcessed(&cei.lowIndex, &cei.highIndex, status);
+        if (U_FAILURE(*status)) {
+            return 0;
+        }
+        if (cei.ce == UCOL_PROCESSED_NULLORDER) {
+            break;
+        }
+        ++textCEsLength;
+    }
+
+    const CEI *textCEs = msearch->textCEs;
+    int32_t count = 0;
+    for (int32_t targetIx = 0; targetIx < textCEsLength; ++targetIx) {
+        // Walk the pattern trie along the text CEs starting at targetIx.
+        int32_t start = 0;
+        int32_t limit = msearch->patternCount;
+        for (int32_t depth = 0;; ++depth) {
+            for (; start < limit; ++start) {
+                int32_t patIndex = msearch->order[start];
+                int32_t pcesLength = msearch->pceStarts[patIndex + 1] - msearch->pceStarts[patIndex];
+                if (pcesLength != depth) {
+                    break;
+                }
+                if (depth == 0) {
+                    continue;  // no CEs: never matches
+                }
+                // Match in CE space. Check the text bounds as usearch_search() does.
+                const CEI *lastCEI = textCEs + targetIx + depth - 1;
+                const CEI *nextCEI = lastCEI + 1;
+                int32_t mLimit;
+                if ((nextCEI->lowIndex == nextCEI->highIndex && nextCEI->ce != UCOL_PROCESSED_NULLORDER) ||
+                        !checkMatchBounds(strsrch, textCEs + targetIx, lastCEI, nextCEI,
+                                          nextCEI->lowIndex,
+                                          msearch->patternText + msearch->patternStarts[patIndex],
+                                          msearch->patternStarts[patIndex + 1] - msearch->patternStarts[patIndex],
+                                          &mLimit)) {
+                    continue;
+                }
+                if (count < capacity) {
+                    matches[count].patternIndex = patIndex;
+                    matches[count].start = textCEs[targetIx].lowIndex;
+                    matches[count].limit = mLimit;
+                }
+                ++count;
+            }
+            if (start == limit || (targetIx + depth) >= textCEsLength) {
+                break;
+            }
+            uint64_t ce = (uint64_t)textCEs[targetIx + depth].ce;
+            start = findPatternCE(msearch, start, limit, depth, ce, FALSE);
+            limit = findPatternCE(msearch, start, limit, depth, ce, TRUE);
+        }
+    }
+    if (count > capacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -161,6 +161,8 @@ struct UPattern {
           int16_t             defaultShiftSize;
           int16_t             shift[MAX_TABLE_SIZE_];
           int16_t             backShift[MAX_TABLE_SIZE_];
+          // Boyer-Moore-Horspool shifts over pces, indexed by hashFromPCE()
+          int32_t             pceShift[MAX_TABLE_SIZE_];
 };
 
 struct UStringSearch {
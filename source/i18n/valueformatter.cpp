@@ -100,21 +100,18 @@ ValueFormatter::isFastFormattable(int32_t value) const {
     return FALSE;
 }
 
-DigitList &
-ValueFormatter::round(DigitList &value, UErrorCode &status) const {
-    if (value.isNaN() || value.isInfinite()) {
-        return value;
-    }
+UBool
+ValueFormatter::isFastFormattableInt64() const {
     switch (fType) {
     case kFixedDecimal:
-        return fFixedPrecision->round(value, 0, status);
+        return fFixedPrecision->isFastFormattable() && fFixedOptions->isFastFormattable();
     case kScientificNotation:
-        return fScientificPrecision->round(value, status);
+        return FALSE;
     default:
         U_ASSERT(FALSE);
         break;
     }
-    return value;
+    return FALSE;
 }
 
 UnicodeString &
@@ -143,6 +140,33 @@ ValueFormatter::formatInt32(
     return appendTo;
 }
 
+UnicodeString &
+ValueFormatter::formatInt64(
+        int64_t value,
+        FieldPositionHandler &handler,
+        UnicodeString &appendTo) const {
+    switch (fType) {
+    case kFixedDecimal:
+        {
+            IntDigitCountRange range(
+                    fFixedPrecision->fMin.getIntDigitCount(),
+                    fFixedPrecision->fMax.getIntDigitCount());
+            return fDigitFormatter->formatPositiveInt64(
+                    value,
+                    range,
+                    *fGrouping,
+                    handler,
+                    appendTo);
+        }
+        break;
+    case kScientificNotation:
+    default:
+        U_ASSERT(FALSE);
+        break;
+    }
+    return appendTo;
+}
+
 UnicodeString &
 ValueFormatter::format(
         const VisibleDigitsWithExponent &value,
@@ -47,21 +47,19 @@ public:
 
     virtual ~ValueFormatter();
 
-    /**
-     * This function is here only to support the protected round() method
-     * in DecimalFormat. It serves no ther purpose than that.
-     *
-     * @param value this value is rounded in place.
-     * @param status any error returned here.
-     */
-    DigitList &round(DigitList &value, UErrorCode &status) const;
-
     /**
      * Returns TRUE if the absolute value of value can be fast formatted
      * using ValueFormatter::formatInt32.
      */
     UBool isFastFormattable(int32_t value) const;
 
+    /**
+     * Returns TRUE if the absolute value of any integer can be fast
+     * formatted using ValueFormatter::formatInt64.
+     * Unlike isFastFormattable, this allows digit grouping.
+     */
+    UBool isFastFormattableInt64() const;
+
     /**
      * Converts value to a VisibleDigitsWithExponent.
      * Result may be fixed point or scientific.
@@ -103,6 +101,16 @@ public:
         FieldPositionHandler &handler,
         UnicodeString &appendTo) const;
 
+    /**
+     * formats positiveValue and appends to appendTo. Returns appendTo.
+     * value must be positive. Calling formatInt64 when
+     * isFastFormattableInt64 returns FALSE results in undefined behavior.
+     */
+    UnicodeString &formatInt64(
+        int64_t positiveValue,
+        FieldPositionHandler &handler,
+        UnicodeString &appendTo) const;
+
     /**
      * Returns the number of code points needed to format.
      * @param positiveValue if negative, the negative sign is not included
@@ -74,6 +74,10 @@ UBool VisibleDigits::isNaNOrInfinity() const {
     return (fFlags & (kInfinite | kNaN)) != 0;
 }
 
+double VisibleDigits::getAbsDoubleValue() const {
+    return fAbsDoubleValueSet ? fAbsDoubleValue : computeAbsDoubleValue();
+}
+
 double VisibleDigits::computeAbsDoubleValue() const {
     // Take care of NaN and infinity
     if (isNaN()) {
@@ -133,11 +137,7 @@ void VisibleDigits::getFixedDecimal(
     }
 
     // source
-    if (fAbsDoubleValueSet) {
-        source = fAbsDoubleValue;
-    } else {
-        source = computeAbsDoubleValue();
-    }
+    source = getAbsDoubleValue();
 
     // visible decimal digits
     v = fInterval.getFracDigitCount();
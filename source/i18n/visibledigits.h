@@ -56,6 +56,12 @@ public:
      */
     const DigitInterval &getInterval() const { return fInterval; }
 
+    /**
+     * Returns the absolute value of the visible digits as a double.
+     * If isNaN() or isInfinity() return TRUE, returns NaN or infinity.
+     */
+    double getAbsDoubleValue() const;
+
     /**
      * Gets the parameters needed to create a FixedDecimal.
      */
@@ -37,6 +37,7 @@ static void TestAttribute(void);
 static void TestDefault(void);
 static void TestDefaultKeyword(void);
 static void TestBengaliSortKey(void);
+static void TestSortStrings(void);
 
 
 static char* U_EXPORT2 ucol_sortKeyToString(const UCollator *coll, const uint8_t *sortkey, char *buffer, uint32_t len) {
@@ -87,6 +88,7 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestBengaliSortKey, "tscoll/capitst/TestBengaliSortKey");
     addTest(root, &TestGetKeywordValuesForLocale, "tscoll/capitst/TestGetKeywordValuesForLocale");
     addTest(root, &TestStrcollNull, "tscoll/capitst/TestStrcollNull");
+    addTest(root, &TestSortStrings, "tscoll/capitst/TestSortStrings");
 }
 
 void TestGetSetAttr(void) {
@@ -2558,4 +2560,73 @@ static void TestStrcollNull(void) {
     ucol_close(coll);
 }
 
+static void TestSortStrings(void) {
+    /* Few distinct characters and long strings so that many strings share sort key prefixes. */
+    static const UChar chars[] = { 0x61, 0x41, 0x62, 0xe4, 0x63, 0x2d };
+    enum { COUNT = 300, MAX_LENGTH = 14 };
+    UChar buffer[COUNT][MAX_LENGTH + 1];
+    const UChar *strings[COUNT];
+    int32_t lengths[COUNT];
+    int32_t permutation[COUNT];
+    UBool seen[COUNT];
+    uint32_t random = 1;
+    int32_t i, j, pass;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("en", &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(en) failed: %s\n", u_errorName(status));
+        return;
+    }
+    for (i = 0; i < COUNT; ++i) {
+        int32_t length;
+        random = random * 1103515245 + 12345;
+        length = 1 + (int32_t)((random >> 16) % MAX_LENGTH);
+        for (j = 0; j < length; ++j) {
+            random = random * 1103515245 + 12345;
+            buffer[i][j] = chars[(random >> 16) % UPRV_LENGTHOF(chars)];
+        }
+        buffer[i][length] = 0;
+        strings[i] = buffer[i];
+        lengths[i] = length;
+    }
+    for (pass = 0; pass < 2; ++pass) {
+        /* pass 0: NUL-terminated strings; pass 1: explicit lengths */
+        ucol_sortStrings(coll, strings, pass == 0 ? NULL : lengths, COUNT, permutation, &status);
+        if (U_FAILURE(status)) {
+            log_err("ucol_sortStrings(pass %d) failed: %s\n", (int)pass, u_errorName(status));
+            break;
+        }
+        uprv_memset(seen, 0, sizeof(seen));
+        for (i = 0; i < COUNT; ++i) {
+            int32_t index = permutation[i];
+            if (index < 0 || COUNT <= index || seen[index]) {
+                log_err("ucol_sortStrings(pass %d) permutation[%d]=%d is not a permutation\n",
+                        (int)pass, (int)i, (int)index);
+                break;
+            }
+            seen[index] = TRUE;
+            if (i > 0) {
+                int32_t prev = permutation[i - 1];
+                UCollationResult order = ucol_strcoll(coll, strings[prev], -1, strings[index], -1);
+                if (order == UCOL_GREATER || (order == UCOL_EQUAL && prev > index)) {
+                    log_err("ucol_sortStrings(pass %d) strings %d and %d are out of order\n",
+                            (int)pass, (int)prev, (int)index);
+                }
+            }
+        }
+    }
+    /* Zero strings, and error handling. */
+    status = U_ZERO_ERROR;
+    ucol_sortStrings(coll, NULL, NULL, 0, NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err("ucol_sortStrings(count=0) failed: %s\n", u_errorName(status));
+    }
+    ucol_sortStrings(coll, strings, NULL, -1, permutation, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_sortStrings(count=-1) did not fail with U_ILLEGAL_ARGUMENT_ERROR: %s\n",
+                u_errorName(status));
+    }
+    ucol_close(coll);
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
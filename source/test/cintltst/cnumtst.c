@@ -29,6 +29,7 @@
 #include "unicode/unumsys.h"
 #include "unicode/ustring.h"
 #include "unicode/udisplaycontext.h"
+#include "unicode/uclean.h"
 
 #include "cintltst.h"
 #include "cnumtst.h"
@@ -62,6 +63,7 @@ static void TestContext(void);
 static void TestCurrencyUsage(void);
 static void TestCurrFmtNegSameAsPositive(void);
 static void TestVariousStylesAndAttributes(void);
+static void TestFormatNoHeap(void);
 
 #define TESTCASE(x) addTest(root, &x, "tsformat/cnumtst/" #x)
 
@@ -91,6 +93,7 @@ void addNumForTest(TestNode** root)
     TESTCASE(TestCurrencyUsage);
     TESTCASE(TestCurrFmtNegSameAsPositive);
     TESTCASE(TestVariousStylesAndAttributes);
+    TESTCASE(TestFormatNoHeap);
 }
 
 /* test Parse int 64 */
@@ -2860,4 +2863,106 @@ static void TestVariousStylesAndAttributes(void) {
     }
 }
 
+/* Counts heap allocations made through ICU while TestFormatNoHeap runs. */
+static int32_t gFormatAllocCount = 0;
+
+static void * U_CALLCONV countingAlloc(const void *context, size_t size) {
+    ++gFormatAllocCount;
+    return malloc(size);
+}
+
+static void * U_CALLCONV countingRealloc(const void *context, void *mem, size_t size) {
+    ++gFormatAllocCount;
+    return realloc(mem, size);
+}
+
+static void U_CALLCONV countingFree(const void *context, void *mem) {
+    free(mem);
+}
+
+/*
+ * Without a field position, unum_formatDouble() and unum_formatInt64() format
+ * a DecimalFormat straight into the destination buffer, without heap allocations.
+ * Heap functions can only be set while ICU is not in use, so this test
+ * cleans up ICU first, like hpmufn/TestHeapFunctions.
+ */
+static void TestFormatNoHeap(void) {
+    static const char *const locales[] = { "en", "de", "fr", "ar", "ja", "en@numbers=arab" };
+    static const UNumberFormatStyle styles[] = {
+        UNUM_DECIMAL, UNUM_CURRENCY, UNUM_PERCENT, UNUM_SCIENTIFIC, UNUM_CURRENCY_ISO
+    };
+    static const double values[] = {
+        0.0, 1.0, -1.0, 0.5, -1234.5678, 0.1 + 0.2, 123456789.123, 1e-5, 1e20, -9.87e15
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    const char *dataDir = u_getDataDirectory();  /* Returned string vanishes with u_cleanup */
+    char *icuDataDir = (char *)malloc(uprv_strlen(dataDir) + 1);
+    int32_t i, j, k;
+
+    uprv_strcpy(icuDataDir, dataDir);
+    u_cleanup();
+    u_setMemoryFunctions(NULL, countingAlloc, countingRealloc, countingFree, &status);
+    u_setDataDirectory(icuDataDir);
+    free(icuDataDir);
+    u_init(&status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "u_setMemoryFunctions()/u_init() failed - %s\n", u_errorName(status));
+        ctest_resetICU();
+        return;
+    }
+
+    for (i = 0; i < LENGTH(locales); ++i) {
+        for (j = 0; j < LENGTH(styles); ++j) {
+            UNumberFormat *fmt;
+            gFormatAllocCount = 0;
+            fmt = unum_open(styles[j], NULL, 0, locales[i], NULL, &status);
+            if (U_FAILURE(status)) {
+                log_data_err("unum_open(%d, %s) failed - %s\n", (int)styles[j], locales[i], u_errorName(status));
+                ctest_resetICU();
+                return;
+            }
+            if (gFormatAllocCount == 0) {
+                log_err("Heap functions are not being called from ICU.\n");
+            }
+            for (k = 0; k < LENGTH(values) * 2; ++k) {
+                double d = values[k / 2];
+                int64_t n = (int64_t)(d * 1000);
+                UFieldPosition pos = { 0, 0, 0 };
+                UChar expected[100];
+                UChar actual[100];
+                int32_t expectedLength, actualLength, allocCount;
+
+                /* A field position takes the general path, which may allocate. */
+                if ((k & 1) == 0) {
+                    expectedLength = unum_formatDouble(fmt, d, expected, LENGTH(expected), &pos, &status);
+                } else {
+                    expectedLength = unum_formatInt64(fmt, n, expected, LENGTH(expected), &pos, &status);
+                }
+                gFormatAllocCount = 0;
+                if ((k & 1) == 0) {
+                    actualLength = unum_formatDouble(fmt, d, actual, LENGTH(actual), NULL, &status);
+                } else {
+                    actualLength = unum_formatInt64(fmt, n, actual, LENGTH(actual), NULL, &status);
+                }
+                allocCount = gFormatAllocCount;
+                if (U_FAILURE(status)) {
+                    log_err("%s/%d: formatting %g failed - %s\n",
+                            locales[i], (int)styles[j], d, u_errorName(status));
+                    status = U_ZERO_ERROR;
+                } else if (actualLength != expectedLength || u_strncmp(actual, expected, actualLength) != 0) {
+                    log_err("%s/%d: formatting %g with and without a field position differs\n",
+                            locales[i], (int)styles[j], d);
+                } else if (allocCount != 0) {
+                    log_err("%s/%d: formatting %g into a buffer allocated memory %d times\n",
+                            locales[i], (int)styles[j], d, (int)allocCount);
+                }
+            }
+            unum_close(fmt);
+        }
+    }
+
+    /* Cleanup puts the heap back to its default implementation. */
+    ctest_resetICU();
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
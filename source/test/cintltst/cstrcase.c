@@ -710,6 +710,47 @@ TestCaseCompare(void) {
     }
 }
 
+static void
+TestCaseFoldHash(void) {
+    static const UChar
+    mixed[]=               { 0x61, 0x42, 0x131, 0x3a3, 0xdf,       0xfb03,           0xd93f, 0xdfff, 0 },
+    otherDefault[]=        { 0x41, 0x62, 0x131, 0x3c3, 0x73, 0x53, 0x46, 0x66, 0x49, 0xd93f, 0xdfff, 0 },
+    otherExcludeSpecialI[]={ 0x41, 0x62, 0x131, 0x3c3, 0x53, 0x73, 0x66, 0x46, 0x69, 0xd93f, 0xdfff, 0 };
+    UChar folded[32];
+    int32_t hash, foldedLength;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    hash=u_strFoldCaseHash(mixed, -1, U_FOLD_CASE_DEFAULT);
+    if(hash!=u_strFoldCaseHash(otherDefault, u_strlen(otherDefault), U_FOLD_CASE_DEFAULT)) {
+        log_err("error: u_strFoldCaseHash(mixed, default)!=u_strFoldCaseHash(other, default)\n");
+    }
+    foldedLength=u_strFoldCase(folded, UPRV_LENGTHOF(folded), mixed, -1, U_FOLD_CASE_DEFAULT, &errorCode);
+    if(U_FAILURE(errorCode) ||
+        hash!=u_strFoldCaseHash(folded, foldedLength, U_FOLD_CASE_DEFAULT)
+    ) {
+        log_err("error: u_strFoldCaseHash(mixed, default)!=u_strFoldCaseHash(u_strFoldCase(mixed)) - %s\n",
+                u_errorName(errorCode));
+    }
+
+    hash=u_strFoldCaseHash(mixed, -1, U_FOLD_CASE_EXCLUDE_SPECIAL_I);
+    if(hash!=u_strFoldCaseHash(otherExcludeSpecialI, -1, U_FOLD_CASE_EXCLUDE_SPECIAL_I)) {
+        log_err("error: u_strFoldCaseHash(mixed, exclude special i)!=u_strFoldCaseHash(other, exclude special i)\n");
+    }
+
+    /* the first 4 code points are the same with either set of options */
+    hash=u_strFoldCaseHash(mixed, 4, U_FOLD_CASE_DEFAULT);
+    if(hash!=u_strFoldCaseHash(otherExcludeSpecialI, 4, U_FOLD_CASE_DEFAULT)) {
+        log_err("error: u_strFoldCaseHash(mixed, 4)!=u_strFoldCaseHash(other, 4)\n");
+    }
+
+    if(u_strFoldCaseHash(NULL, 3, U_FOLD_CASE_DEFAULT)!=0 ||
+        u_strFoldCaseHash(mixed, -2, U_FOLD_CASE_DEFAULT)!=0 ||
+        u_strFoldCaseHash(mixed, 0, U_FOLD_CASE_DEFAULT)!=0
+    ) {
+        log_err("error: u_strFoldCaseHash(NULL or length<=-2 or empty)!=0\n");
+    }
+}
+
 /* test UCaseMap ------------------------------------------------------------ */
 
 /*
@@ -1045,6 +1086,7 @@ void addCaseTest(TestNode** root) {
 #endif
     addTest(root, &TestCaseFolding, "tsutil/cstrcase/TestCaseFolding");
     addTest(root, &TestCaseCompare, "tsutil/cstrcase/TestCaseCompare");
+    addTest(root, &TestCaseFoldHash, "tsutil/cstrcase/TestCaseFoldHash");
     addTest(root, &TestUCaseMap, "tsutil/cstrcase/TestUCaseMap");
 #if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILE_IO
     addTest(root, &TestUCaseMapToTitle, "tsutil/cstrcase/TestUCaseMapToTitle");
@@ -23,6 +23,7 @@
 #include "unicode/ustring.h"
 #include "unicode/uloc.h"
 #include "unicode/unorm2.h"
+#include "unicode/upropbits.h"
 
 #include "cintltst.h"
 #include "putilimp.h"
@@ -60,6 +61,7 @@ static void TestConsistency(void);
 static void TestUCase(void);
 static void TestUBiDiProps(void);
 static void TestCaseFolding(void);
+static void TestPropertyBits(void);
 
 /* internal methods used */
 static int32_t MakeProp(char* str);
@@ -197,6 +199,7 @@ void addUnicodeTest(TestNode** root)
     addTest(root, &TestUCase, "tsutil/cucdtst/TestUCase");
     addTest(root, &TestUBiDiProps, "tsutil/cucdtst/TestUBiDiProps");
     addTest(root, &TestCaseFolding, "tsutil/cucdtst/TestCaseFolding");
+    addTest(root, &TestPropertyBits, "tsutil/cucdtst/TestPropertyBits");
 }
 
 /*==================================================== */
@@ -3550,3 +3553,184 @@ TestCaseFolding() {
 
     uset_close(data.notSeen);
 }
+
+/* test UPropertyBits ------------------------------------------------------- */
+
+static void
+checkPropertyBits(const UPropertyBits *pbits, const UProperty *properties, int32_t count,
+                  const char *name) {
+    /* a mix of ASCII, BMP, surrogate pairs and an unpaired surrogate */
+    static const UChar s[]={
+        0x41, 0x20, 0x31, 0x5f, 0x9, 0x4e00, 0x300, 0xd800, 0xdc00,
+        0xd835, 0xdc1a, 0xdfff, 0x3000, 0xff21, 0xdbff, 0xdfff, 0
+    };
+    uint32_t bits[UPRV_LENGTHOF(s)];
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t i, j, length;
+    UChar32 c;
+
+    if(upbits_countProperties(pbits)!=count) {
+        log_err("%s: upbits_countProperties()=%ld!=%ld\n", name, (long)upbits_countProperties(pbits), (long)count);
+    }
+    for(j=0; j<count; ++j) {
+        if(upbits_getProperty(pbits, j)!=properties[j]) {
+            log_err("%s: upbits_getProperty(%ld) wrong\n", name, (long)j);
+        }
+    }
+    if(upbits_getProperty(pbits, count)!=UCHAR_INVALID_CODE) {
+        log_err("%s: upbits_getProperty(count)!=UCHAR_INVALID_CODE\n", name);
+    }
+
+    for(c=0; c<=0x10ffff; c+=(c<0x3400 ? 1 : 0x3f)) {
+        /* the documented layout: consecutive fields wide enough for the maximum values */
+        uint32_t expected=0;
+        int32_t shift=0;
+        for(j=0; j<count; ++j) {
+            int32_t value=u_getIntPropertyValue(c, properties[j]);
+            int32_t maxValue=u_getIntPropertyMaxValue(properties[j]);
+            expected|=(uint32_t)value<<shift;
+            do { ++shift; } while((maxValue>>=1)!=0);
+            if(upbits_getValue(pbits, upbits_get(pbits, c), j)!=value) {
+                log_err("%s: upbits_getValue(U+%04lx, %ld)=%ld!=%ld\n",
+                        name, (long)c, (long)j,
+                        (long)upbits_getValue(pbits, upbits_get(pbits, c), j), (long)value);
+                break;
+            }
+        }
+        if(upbits_get(pbits, c)!=expected) {
+            log_err("%s: upbits_get(U+%04lx)=0x%lx!=0x%lx\n",
+                    name, (long)c, (long)upbits_get(pbits, c), (long)expected);
+            break;
+        }
+    }
+    if(upbits_getValue(pbits, 0xffffffff, count)!=0 || upbits_getValue(pbits, 0xffffffff, -1)!=0) {
+        log_err("%s: upbits_getValue(index out of range)!=0\n", name);
+    }
+    if(upbits_get(pbits, -1)!=0 || upbits_get(pbits, 0x110000)!=0) {
+        log_err("%s: upbits_get(out of range)!=0\n", name);
+    }
+
+    length=u_getPropertyBitsBulk(pbits, s, -1, bits, UPRV_LENGTHOF(bits), &errorCode);
+    if(U_FAILURE(errorCode) || length!=UPRV_LENGTHOF(s)-1) {
+        log_err("%s: u_getPropertyBitsBulk()=%ld failed - %s\n", name, (long)length, u_errorName(errorCode));
+        return;
+    }
+    for(i=0; i<length;) {
+        int32_t start=i;
+        U16_NEXT(s, i, length, c);
+        for(j=start; j<i; ++j) {
+            if(bits[j]!=upbits_get(pbits, c)) {
+                log_err("%s: u_getPropertyBitsBulk()[%ld]=0x%lx!=upbits_get(U+%04lx)\n",
+                        name, (long)j, (long)bits[j], (long)c);
+            }
+        }
+    }
+    length=u_getPropertyBitsBulk(pbits, s, -1, bits, 3, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=UPRV_LENGTHOF(s)-1) {
+        log_err("%s: u_getPropertyBitsBulk(capacity 3)=%ld - %s\n", name, (long)length, u_errorName(errorCode));
+    }
+}
+
+/* serializes pbits, checks the reopened object, and checks rejection of a corrupt trie size */
+static void
+checkSerializedPropertyBits(const UPropertyBits *pbits, const UProperty *properties, int32_t count,
+                            const char *name) {
+    UPropertyBits *pbits2;
+    uint32_t *buffer;
+    int32_t *indexes;
+    int32_t length;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    length=upbits_serialize(pbits, NULL, 0, &errorCode);
+    if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length<=0) {
+        log_err("%s: upbits_serialize(preflighting) failed - %s\n", name, u_errorName(errorCode));
+        return;
+    }
+    errorCode=U_ZERO_ERROR;
+    buffer=(uint32_t *)malloc(length);
+    if(upbits_serialize(pbits, buffer, length, &errorCode)!=length || U_FAILURE(errorCode)) {
+        log_err("%s: upbits_serialize() failed - %s\n", name, u_errorName(errorCode));
+        free(buffer);
+        return;
+    }
+    pbits2=upbits_openFromSerialized(buffer, length, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("%s: upbits_openFromSerialized() failed - %s\n", name, u_errorName(errorCode));
+    } else {
+        checkPropertyBits(pbits2, properties, count, name);
+    }
+    upbits_close(pbits2);
+
+    /* indexes[0] is the trie size; it must not reach beyond the data */
+    indexes=(int32_t *)((char *)buffer+((const uint16_t *)buffer)[0]);
+    indexes[0]+=4;
+    errorCode=U_ZERO_ERROR;
+    pbits2=upbits_openFromSerialized(buffer, length, &errorCode);
+    if(errorCode!=U_INVALID_FORMAT_ERROR || pbits2!=NULL) {
+        log_err("%s: upbits_openFromSerialized(trie size too large) did not fail with "
+                "U_INVALID_FORMAT_ERROR - %s\n", name, u_errorName(errorCode));
+    }
+    upbits_close(pbits2);
+    free(buffer);
+}
+
+static void
+TestPropertyBits() {
+    static const UProperty properties[]={
+        UCHAR_ALPHABETIC, UCHAR_WHITE_SPACE, UCHAR_POSIX_ALNUM, UCHAR_IDEOGRAPHIC,
+        UCHAR_DIACRITIC, UCHAR_UPPERCASE, UCHAR_POSIX_PRINT, UCHAR_ID_CONTINUE
+    };
+    static const UProperty enumerated[]={
+        UCHAR_GENERAL_CATEGORY, UCHAR_WHITE_SPACE, UCHAR_SCRIPT,
+        UCHAR_LINE_BREAK, UCHAR_ALPHABETIC, UCHAR_EAST_ASIAN_WIDTH
+    };
+    static const UProperty notSupported[]={ UCHAR_ALPHABETIC, UCHAR_GENERAL_CATEGORY_MASK };
+    static const UProperty tooWide[]={ UCHAR_BLOCK, UCHAR_BLOCK, UCHAR_BLOCK, UCHAR_BLOCK };
+    UPropertyBits *pbits;
+    UChar32 c;
+    UErrorCode errorCode=U_ZERO_ERROR;
+
+    pbits=upbits_open(notSupported, UPRV_LENGTHOF(notSupported), &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR || pbits!=NULL) {
+        log_err("upbits_open(UCHAR_GENERAL_CATEGORY_MASK) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    pbits=upbits_open(tooWide, UPRV_LENGTHOF(tooWide), &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR || pbits!=NULL) {
+        log_err("upbits_open(more than 32 bits) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode=U_ZERO_ERROR;
+    pbits=upbits_open(properties, 0, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR || pbits!=NULL) {
+        log_err("upbits_open(count=0) did not fail with U_ILLEGAL_ARGUMENT_ERROR - %s\n",
+                u_errorName(errorCode));
+    }
+
+    errorCode=U_ZERO_ERROR;
+    pbits=upbits_open(properties, UPRV_LENGTHOF(properties), &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("upbits_open() failed - %s (Are you missing data?)\n", u_errorName(errorCode));
+        return;
+    }
+    checkPropertyBits(pbits, properties, UPRV_LENGTHOF(properties), "binary");
+    checkSerializedPropertyBits(pbits, properties, UPRV_LENGTHOF(properties), "binary deserialized");
+    upbits_close(pbits);
+
+    pbits=upbits_open(enumerated, UPRV_LENGTHOF(enumerated), &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err("upbits_open(enumerated) failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+    checkPropertyBits(pbits, enumerated, UPRV_LENGTHOF(enumerated), "enumerated");
+    checkSerializedPropertyBits(pbits, enumerated, UPRV_LENGTHOF(enumerated), "enumerated deserialized");
+    /* the General_Category field holds the u_charType() values */
+    for(c=0; c<=0xffff; ++c) {
+        if(upbits_getValue(pbits, upbits_get(pbits, c), 0)!=u_charType(c)) {
+            log_err("upbits_getValue(U+%04lx, General_Category)!=u_charType()\n", (long)c);
+            break;
+        }
+    }
+    upbits_close(pbits);
+}
@@ -3005,6 +3005,161 @@ static void TestIndicPrefixMatch(void)
     close();
 }
 
+/**
+* Long patterns in a long text with few distinct characters,
+* so that the search skips ahead by varying amounts,
+* compared with a naive search.
+*/
+static void TestLongPatternSkip(void)
+{
+    static const UChar chars[] = { 0x61, 0x62, 0x63, 0x20 }; /* "abc " */
+    enum { TEXT_LENGTH = 3000 };
+    UChar text[TEXT_LENGTH];
+    uint32_t random = 7;
+    int32_t i, patternStart, patternLength;
+    UErrorCode status = U_ZERO_ERROR;
+    for (i = 0; i < TEXT_LENGTH; ++i) {
+        random = random * 1103515245 + 12345;
+        /* mostly 'a' for many partial matches */
+        text[i] = ((random >> 16) % 3) != 0 ? 0x61 : chars[(random >> 8) % 4];
+    }
+    for (patternLength = 2; patternLength <= 50; patternLength += 3) {
+        for (patternStart = 5; patternStart < TEXT_LENGTH - patternLength; patternStart += 997) {
+            const UChar *pattern = text + patternStart;
+            int32_t expected = 0, actual;
+            UStringSearch *search = usearch_open(pattern, patternLength, text, TEXT_LENGTH,
+                                                 "en", NULL, &status);
+            if (U_FAILURE(status)) {
+                log_err_status(status, "usearch_open() failed: %s\n", u_errorName(status));
+                return;
+            }
+            actual = usearch_first(search, &status);
+            for (;;) {
+                /* naive search for the next non-overlapping match */
+                while (expected <= TEXT_LENGTH - patternLength &&
+                        u_memcmp(text + expected, pattern, patternLength) != 0) {
+                    ++expected;
+                }
+                if (expected > TEXT_LENGTH - patternLength) {
+                    expected = USEARCH_DONE;
+                }
+                if (actual != expected || U_FAILURE(status)) {
+                    log_err("pattern text[%d..%d]: match at %d, expected %d (%s)\n",
+                            (int)patternStart, (int)(patternStart + patternLength),
+                            (int)actual, (int)expected, u_errorName(status));
+                    break;
+                }
+                if (actual == USEARCH_DONE) {
+                    break;
+                }
+                expected += patternLength;
+                actual = usearch_next(search, &status);
+            }
+            usearch_close(search);
+        }
+    }
+}
+
+static void TestMultiPattern(void)
+{
+    static const char *const patternChars[] = {
+        "resume", "Resume", "res", "cote", "côte", "coté", "e", "sumé", "\\u00E4b", "\\u0300", "xyz"
+    };
+    static const char textChars[] =
+        "R\\u00E9sum\\u00E9 of the c\\u00F4te: resume, cot\\u00E9, COTE, a\\u0308b, \\u00C4B, re\\u0301sume\\u0301.";
+    enum { PATTERN_COUNT = UPRV_LENGTHOF(patternChars), MAX_MATCHES = 100 };
+    UChar patterns[PATTERN_COUNT][20];
+    const UChar *patternPointers[PATTERN_COUNT];
+    UChar text[120];
+    UMultiStringSearchMatch matches[MAX_MATCHES];
+    int32_t textLength, count, expectedCount, i, j;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("en", &status);
+    UMultiStringSearch *msearch;
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(en) failed: %s\n", u_errorName(status));
+        return;
+    }
+    ucol_setStrength(coll, UCOL_PRIMARY);
+    for (i = 0; i < PATTERN_COUNT; ++i) {
+        u_unescape(patternChars[i], patterns[i], UPRV_LENGTHOF(patterns[i]));
+        patternPointers[i] = patterns[i];
+    }
+    textLength = u_unescape(textChars, text, UPRV_LENGTHOF(text));
+    msearch = usearch_openMulti(patternPointers, NULL, PATTERN_COUNT, coll, &status);
+    count = usearch_findAllMulti(msearch, text, textLength, matches, MAX_MATCHES, &status);
+    if (U_FAILURE(status)) {
+        log_err("usearch_findAllMulti() failed: %s\n", u_errorName(status));
+        usearch_closeMulti(msearch);
+        ucol_close(coll);
+        return;
+    }
+
+    /*
+     * Each pattern's matches must be the ones found by a single-pattern overlapping search.
+     * Skip the ignorable pattern: usearch_next() returns empty matches for it.
+     */
+    expectedCount = 0;
+    for (i = 0; i < PATTERN_COUNT; ++i) {
+        UStringSearch *search;
+        int32_t start;
+        if (i == 9) {
+            continue;
+        }
+        search = usearch_openFromCollator(patterns[i], -1, text, textLength,
+                                          coll, NULL, &status);
+        usearch_setAttribute(search, USEARCH_OVERLAP, USEARCH_ON, &status);
+        for (start = usearch_first(search, &status);
+                start != USEARCH_DONE && U_SUCCESS(status);
+                start = usearch_next(search, &status)) {
+            int32_t limit = start + usearch_getMatchedLength(search);
+            UBool found = FALSE;
+            for (j = 0; j < count; ++j) {
+                if (matches[j].patternIndex == i && matches[j].start == start && matches[j].limit == limit) {
+                    found = TRUE;
+                    break;
+                }
+            }
+            if (!found) {
+                log_err("pattern %d \"%s\": match [%d, %d[ not found by usearch_findAllMulti()\n",
+                        (int)i, patternChars[i], (int)start, (int)limit);
+            }
+            ++expectedCount;
+        }
+        usearch_close(search);
+    }
+    if (U_FAILURE(status)) {
+        log_err("single-pattern search failed: %s\n", u_errorName(status));
+    } else if (count != expectedCount) {
+        log_err("usearch_findAllMulti() found %d matches, expected %d\n", (int)count, (int)expectedCount);
+    }
+    for (j = 1; j < count; ++j) {
+        if (matches[j].start < matches[j - 1].start) {
+            log_err("usearch_findAllMulti() match %d out of order\n", (int)j);
+        }
+    }
+    for (j = 0; j < count; ++j) {
+        if (matches[j].patternIndex == 9 || matches[j].patternIndex == 10) {
+            log_err("pattern %d \"%s\" should not match\n",
+                    (int)matches[j].patternIndex, patternChars[matches[j].patternIndex]);
+        }
+    }
+
+    /* preflighting */
+    i = usearch_findAllMulti(msearch, text, textLength, matches, 2, &status);
+    if (status != U_BUFFER_OVERFLOW_ERROR || i != count) {
+        log_err("usearch_findAllMulti(capacity 2) returned %d, %s; expected %d, U_BUFFER_OVERFLOW_ERROR\n",
+                (int)i, u_errorName(status), (int)count);
+    }
+    status = U_ZERO_ERROR;
+    i = usearch_findAllMulti(msearch, text, 0, NULL, 0, &status);
+    if (U_FAILURE(status) || i != 0) {
+        log_err("usearch_findAllMulti(empty text) returned %d, %s\n", (int)i, u_errorName(status));
+    }
+    usearch_closeMulti(msearch);
+    ucol_close(coll);
+}
+
 /**
 * addSearchTest
 */
@@ -3068,6 +3223,8 @@ void addSearchTest(TestNode** root)
     addTest(root, &TestPCEBuffer_2surr, "tscoll/usrchtst/TestPCEBuffer/2_dfff");
     addTest(root, &TestMatchFollowedByIgnorables, "tscoll/usrchtst/TestMatchFollowedByIgnorables");
     addTest(root, &TestIndicPrefixMatch, "tscoll/usrchtst/TestIndicPrefixMatch");
+    addTest(root, &TestLongPatternSkip, "tscoll/usrchtst/TestLongPatternSkip");
+    addTest(root, &TestMultiPattern, "tscoll/usrchtst/TestMultiPattern");
 }
 
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -40,6 +40,23 @@ UnicodeString joinLabelsAndAppend(AlphabeticIndex::ImmutableIndex &index, Unicod
     return dest;
 }
 
+UnicodeString joinRangeNames(const AlphabeticIndex::PrefixIndex &index,
+                             const int32_t *ranges, int32_t count) {
+    UnicodeString dest;
+    for (int32_t i = 0; i < count; ++i) {
+        if (i > 0) {
+            dest.append((UChar)0x7C);  // '|'
+        }
+        for (int32_t j = ranges[2 * i]; j < ranges[2 * i + 1]; ++j) {
+            if (j > ranges[2 * i]) {
+                dest.append((UChar)0x2C);  // ','
+            }
+            dest.append(*index.getRecordName(j));
+        }
+    }
+    return dest;
+}
+
 }  // namespace
 
 AlphabeticIndexTest::AlphabeticIndexTest() {
@@ -64,6 +81,8 @@ void AlphabeticIndexTest::runIndexedTest( int32_t index, UBool exec, const char*
     TESTCASE_AUTO(TestChineseZhuyin);
     TESTCASE_AUTO(TestJapaneseKanji);
     TESTCASE_AUTO(TestChineseUnihan);
+    TESTCASE_AUTO(TestPrefixIndex);
+    TESTCASE_AUTO(TestBucketIndexes);
     TESTCASE_AUTO_END;
 }
 
@@ -722,4 +741,102 @@ void AlphabeticIndexTest::TestChineseUnihan() {
     assertEquals("getBucketIndex(U+7527)", 101, bucketIndex);
 }
 
+void AlphabeticIndexTest::TestPrefixIndex() {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t ranges[8];
+    AlphabeticIndex index(Locale::getEnglish(), status);
+    static const char *const names[] = {
+        "apple", "R\\u00E9sum\\u00E9", "resume", "rest", "rabbit", "reset", "zoo"
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        index.addRecord(UnicodeString(names[i], -1, US_INV).unescape(), (void *)names[i], status);
+    }
+    LocalPointer<AlphabeticIndex::PrefixIndex> prefixIndex(index.buildPrefixIndex(status));
+    TEST_CHECK_STATUS;
+    // Records added later are not in the PrefixIndex.
+    index.addRecord(UnicodeString("resumes"), NULL, status);
+    assertEquals("getRecordCount()", UPRV_LENGTHOF(names), prefixIndex->getRecordCount());
+    assertTrue("getRecordName(out of range)", prefixIndex->getRecordName(-1) == NULL);
+    assertTrue("getRecordData(out of range)", prefixIndex->getRecordData(7) == NULL);
+    assertTrue("record 0 data", prefixIndex->getRecordData(0) == names[0]);
+
+    int32_t count = prefixIndex->getPrefixRanges(UnicodeString("res"), ranges, 4, status);
+    TEST_CHECK_STATUS;
+    assertEquals("res", UnicodeString("reset,rest,resume,R\\u00E9sum\\u00E9").unescape(),
+                 joinRangeNames(*prefixIndex, ranges, count));
+    count = prefixIndex->getPrefixRanges(UnicodeString("R\\u00C9SU").unescape(), ranges, 4, status);
+    assertEquals("R\\u00C9SU", UnicodeString("resume,R\\u00E9sum\\u00E9").unescape(),
+                 joinRangeNames(*prefixIndex, ranges, count));
+    count = prefixIndex->getPrefixRanges(UnicodeString("resumes"), ranges, 4, status);
+    assertEquals("resumes: no match", 0, count);
+    count = prefixIndex->getPrefixRanges(UnicodeString(), ranges, 4, status);
+    assertEquals("empty prefix matches all", UnicodeString("apple,rabbit,reset,rest,resume,R\\u00E9sum\\u00E9,zoo").unescape(),
+                 joinRangeNames(*prefixIndex, ranges, count));
+    TEST_CHECK_STATUS;
+
+    // In Slovak, "ch" is a letter that sorts between "h" and "i".
+    AlphabeticIndex skIndex(Locale("sk"), status);
+    static const char *const skNames[] = { "hora", "chata", "cena", "ihla", "cibu\\u013Ea" };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(skNames); ++i) {
+        skIndex.addRecord(UnicodeString(skNames[i], -1, US_INV).unescape(), NULL, status);
+    }
+    LocalPointer<AlphabeticIndex::PrefixIndex> skPrefixIndex(skIndex.buildPrefixIndex(status));
+    TEST_CHECK_STATUS;
+    count = skPrefixIndex->getPrefixRanges(UnicodeString("c"), ranges, 4, status);
+    assertEquals("sk c", UnicodeString("cena,cibu\\u013Ea|chata").unescape(),
+                 joinRangeNames(*skPrefixIndex, ranges, count));
+    count = skPrefixIndex->getPrefixRanges(UnicodeString("ch"), ranges, 4, status);
+    assertEquals("sk ch", UnicodeString("chata"), joinRangeNames(*skPrefixIndex, ranges, count));
+    count = skPrefixIndex->getPrefixRanges(UnicodeString("h"), ranges, 4, status);
+    assertEquals("sk h", UnicodeString("hora"), joinRangeNames(*skPrefixIndex, ranges, count));
+    TEST_CHECK_STATUS;
+
+    // Preflighting.
+    count = skPrefixIndex->getPrefixRanges(UnicodeString("c"), NULL, 0, status);
+    assertEquals("sk c preflighting count", 2, count);
+    assertTrue("sk c preflighting error", status == U_BUFFER_OVERFLOW_ERROR);
+}
+
+void AlphabeticIndexTest::TestBucketIndexes() {
+    // getBucketIndexes() must match getBucketIndex() for each name.
+    static const char *const localeNames[] = { "en", "sk", "ru", "ja", "zh", "zh@collation=stroke" };
+    static const char *const names[] = {
+        "", " ", "1", "!", "a", "A", "ab", "Zebra", "\\u00C5ngstr\\u00F6m", "chata", "cena",
+        "hora", "\\u0430\\u0431\\u0432", "\\u0416\\u0443\\u043A", "\\u03B1\\u03B2",
+        "\\u3042", "\\u30AB\\u30BF\\u30AB\\u30CA", "\\u4E00", "\\u5416", "\\u8500", "\\u7527",
+        "\\uD840\\uDC00", "\\uFFFF", "abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz"
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(localeNames); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        AlphabeticIndex index(Locale::createFromName(localeNames[i]), status);
+        LocalPointer<AlphabeticIndex::ImmutableIndex> immIndex(index.buildImmutableIndex(status));
+        TEST_CHECK_STATUS;
+        // Also use the bucket labels as names.
+        int32_t count = UPRV_LENGTHOF(names) + immIndex->getBucketCount();
+        LocalArray<UnicodeString> strings(new UnicodeString[count]);
+        int32_t j = 0;
+        for (; j < UPRV_LENGTHOF(names); ++j) {
+            strings[j] = UnicodeString(names[j], -1, US_INV).unescape();
+        }
+        for (int32_t b = 0; j < count; ++j, ++b) {
+            strings[j] = immIndex->getBucket(b)->getLabel();
+        }
+        LocalArray<int32_t> bucketIndexes(new int32_t[count]);
+        immIndex->getBucketIndexes(strings.getAlias(), count, bucketIndexes.getAlias(), status);
+        TEST_CHECK_STATUS;
+        for (j = 0; j < count; ++j) {
+            int32_t expected = immIndex->getBucketIndex(strings[j], status);
+            assertEquals(UnicodeString(localeNames[i]) + " getBucketIndexes(" + strings[j] + ")",
+                         expected, bucketIndexes[j]);
+        }
+        TEST_CHECK_STATUS;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    AlphabeticIndex index(Locale::getEnglish(), status);
+    LocalPointer<AlphabeticIndex::ImmutableIndex> immIndex(index.buildImmutableIndex(status));
+    TEST_CHECK_STATUS;
+    immIndex->getBucketIndexes(NULL, 1, NULL, status);
+    assertTrue("NULL names", status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
 #endif
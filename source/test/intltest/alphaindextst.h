@@ -47,6 +47,11 @@ public:
     void TestChineseZhuyin();
     void TestJapaneseKanji();
     void TestChineseUnihan();
+    /**
+     * Test collation-prefix lookups, with a contraction at the end of the prefix.
+     */
+    void TestPrefixIndex();
+    void TestBucketIndexes();
 };
 
 #endif
@@ -1216,6 +1216,112 @@ void CollationAPITest::TestSortKey()
     delete col;
 }
 
+void CollationAPITest::TestTruncatedSortKey() {
+    IcuTestErrorCode errorCode(*this, "TestTruncatedSortKey()");
+    LocalPointer<Collator> coll(Collator::createInstance(Locale::getEnglish(), errorCode));
+    if (errorCode.logDataIfFailureAndReset("Collator::createInstance(English) failed")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    if (rbc == NULL) {
+        errln("English collator is not a RuleBasedCollator");
+        return;
+    }
+    LocalPointer<Collator> primaryColl(coll->clone());
+    primaryColl->setAttribute(UCOL_STRENGTH, UCOL_PRIMARY, errorCode);
+    // In collation order.
+    static const char *const strings[] = {
+        "a", "A", "ab", "abc", "ABC", "abcdefghij", "abcdefghik", "b", "c\\u0308", "d"
+    };
+    uint8_t fullKey[100], primaryKey[100], key[100];
+    uint8_t prevKey[3];
+    int32_t prevLength = 0;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+        UnicodeString str = UnicodeString(strings[i], -1, US_INV).unescape();
+        int32_t fullLength = coll->getSortKey(str, fullKey, UPRV_LENGTHOF(fullKey));
+        int32_t primaryLength = primaryColl->getSortKey(str, primaryKey, UPRV_LENGTHOF(primaryKey));
+        for (int32_t capacity = 0; capacity <= fullLength + 1; ++capacity) {
+            uprv_memset(key, 2, UPRV_LENGTHOF(key));
+            int32_t length = rbc->getTruncatedSortKey(str.getBuffer(), str.length(), UCOL_DEFAULT,
+                                                      key, capacity, errorCode);
+            int32_t expectedLength = capacity < fullLength ? capacity : fullLength;
+            if (length != expectedLength || 0 != uprv_memcmp(key, fullKey, length) ||
+                    key[length] != 2) {
+                errln("getTruncatedSortKey(%s, capacity=%d) is not the sort key prefix",
+                      strings[i], (int)capacity);
+            }
+            length = rbc->getTruncatedSortKey(str.getBuffer(), str.length(), UCOL_PRIMARY,
+                                              key, capacity, errorCode);
+            expectedLength = capacity < primaryLength ? capacity : primaryLength;
+            if (length != expectedLength || 0 != uprv_memcmp(key, primaryKey, length)) {
+                errln("getTruncatedSortKey(%s, UCOL_PRIMARY, capacity=%d) is not the primary key prefix",
+                      strings[i], (int)capacity);
+            }
+        }
+        // Truncated keys must not be out of order.
+        int32_t length = ucol_getTruncatedSortKey(coll->toUCollator(), str.getBuffer(), str.length(),
+                                                  UCOL_DEFAULT, key, UPRV_LENGTHOF(prevKey), errorCode);
+        if (i > 0) {
+            int32_t minLength = prevLength < length ? prevLength : length;
+            int32_t cmp = uprv_memcmp(prevKey, key, minLength);
+            if (cmp > 0 || (cmp == 0 && prevLength > length)) {
+                errln("truncated sort key(%s) < truncated sort key(%s)", strings[i], strings[i - 1]);
+            }
+        }
+        uprv_memcpy(prevKey, key, length);
+        prevLength = length;
+    }
+    errorCode.assertSuccess();
+}
+
+void CollationAPITest::TestPrefixKeys() {
+    IcuTestErrorCode errorCode(*this, "TestPrefixKeys()");
+    LocalPointer<Collator> coll(Collator::createInstance(Locale::getEnglish(), errorCode));
+    if (errorCode.logDataIfFailureAndReset("Collator::createInstance(English) failed")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    if (rbc == NULL) {
+        errln("English collator is not a RuleBasedCollator");
+        return;
+    }
+    // Strings with long equal primary prefixes and differences beyond 8 bytes.
+    static const char *const strings[] = {
+        "", "a", "A", "ab", "abc", "ABC", "abcdefghij", "abcdefghij!",
+        "abcdefghijk", "ABCDEFGHIJK", "abcdefghi\u00EAk", "abcdefghijkl",
+        "b", "c\u0308", "d", "-d"
+    };
+    UnicodeString strs[UPRV_LENGTHOF(strings)];
+    CollationPrefixKey keys[UPRV_LENGTHOF(strings)];
+    for (int32_t strength = UCOL_PRIMARY; strength <= UCOL_TERTIARY; ++strength) {
+        rbc->setAttribute(UCOL_STRENGTH, (UColAttributeValue)strength, errorCode);
+        rbc->setAttribute(UCOL_ALTERNATE_HANDLING,
+                          strength == UCOL_SECONDARY ? UCOL_SHIFTED : UCOL_NON_IGNORABLE, errorCode);
+        for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            strs[i] = UnicodeString(strings[i], -1, US_INV).unescape();
+            keys[i].set(*rbc, strs[i].getTerminatedBuffer(), (i & 1) != 0 ? -1 : strs[i].length(),
+                        errorCode);
+        }
+        for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            for (int32_t j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+                UCollationResult expected = rbc->compare(strs[i], strs[j], errorCode);
+                UCollationResult order = rbc->comparePrefixKeys(keys[i], keys[j], errorCode);
+                if (order != expected) {
+                    errln("strength %d: comparePrefixKeys(%s, %s)=%d != compare()=%d",
+                          (int)strength, strings[i], strings[j], order, expected);
+                }
+            }
+        }
+    }
+    // A default-constructed key is for the empty string.
+    CollationPrefixKey empty;
+    assertTrue("empty key == key(\"\")",
+               rbc->comparePrefixKeys(empty, keys[0], errorCode) == UCOL_EQUAL);
+    assertTrue("empty key < key(a)",
+               rbc->comparePrefixKeys(empty, keys[1], errorCode) == UCOL_LESS);
+    errorCode.assertSuccess();
+}
+
 void CollationAPITest::TestSortKeyOverflow() {
     IcuTestErrorCode errorCode(*this, "TestSortKeyOverflow()");
     LocalPointer<Collator> col(Collator::createInstance(Locale::getEnglish(), errorCode));
@@ -2381,6 +2487,52 @@ void CollationAPITest::TestCloneBinary() {
     assertTrue("rbc==rbc3", *rbc == rbc3);
 }
 
+void CollationAPITest::TestRulesCache() {
+    IcuTestErrorCode errorCode(*this, "TestRulesCache");
+    UChar buffer[] = { 0x26, 0x61, 0x3c, 0x62, 0x3c, 0x3c, 0x3c, 0x42, 0 };  // "&a<b<<<B"
+    UnicodeString rules(buffer, -1);
+    // Read-only alias of buffer: The cache must not keep a pointer into it.
+    UnicodeString alias(TRUE, buffer, -1);
+    RuleBasedCollator c1(alias, errorCode);
+    RuleBasedCollator c2(rules, Collator::PRIMARY, errorCode);
+    if(errorCode.logDataIfFailureAndReset("RuleBasedCollator(rules)")) {
+        return;
+    }
+    if(&c1.getRules() != &c2.getRules()) {
+        errln("collators built from the same rules do not share the tailoring");
+    }
+    assertEquals("c1 strength", (int32_t)Collator::TERTIARY, (int32_t)c1.getStrength());
+    assertEquals("c2 strength", (int32_t)Collator::PRIMARY, (int32_t)c2.getStrength());
+    assertEquals("c1 b<B", (int32_t)UCOL_LESS, (int32_t)c1.compare(UnicodeString("b"), UnicodeString("B"), errorCode));
+    assertEquals("c2 b=B", (int32_t)UCOL_EQUAL, (int32_t)c2.compare(UnicodeString("b"), UnicodeString("B"), errorCode));
+    assertEquals("c2 a<b", (int32_t)UCOL_LESS, (int32_t)c2.compare(UnicodeString("a"), UnicodeString("b"), errorCode));
+    // Modify the aliased buffer: The cached tailoring for c1 must still have the old rules.
+    buffer[1] = 0x62;  // "&b<b<<<B"
+    RuleBasedCollator c3(alias, errorCode);
+    if(errorCode.logIfFailureAndReset("RuleBasedCollator(modified alias)")) {
+        return;
+    }
+    assertEquals("c3 rules", UnicodeString("&b<b<<<B"), c3.getRules());
+    assertEquals("c1 rules", rules, c1.getRules());
+    if(&c1.getRules() == &c3.getRules()) {
+        errln("collators built from different rules share the tailoring");
+    }
+    assertEquals("c3 strength", (int32_t)Collator::TERTIARY, (int32_t)c3.getStrength());
+
+    // Parse errors are reported each time, with details.
+    UnicodeString badRules("&a<<<<<b");
+    for(int32_t i = 0; i < 2; ++i) {
+        UParseError parseError;
+        UnicodeString reason;
+        UErrorCode status = U_ZERO_ERROR;
+        RuleBasedCollator bad(badRules, parseError, reason, status);
+        if(U_SUCCESS(status) || reason.isEmpty()) {
+            errln("RuleBasedCollator(%s) #%d did not report a parse error with a reason",
+                  "&a<<<<<b", (int)i);
+        }
+    }
+}
+
 void CollationAPITest::TestIterNumeric() {
     // Regression test for ticket #9915.
     // The collation code sometimes masked the continuation marker away
@@ -2476,6 +2628,8 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestSafeClone);
     TESTCASE_AUTO(TestSortKey);
     TESTCASE_AUTO(TestSortKeyOverflow);
+    TESTCASE_AUTO(TestTruncatedSortKey);
+    TESTCASE_AUTO(TestPrefixKeys);
     TESTCASE_AUTO(TestMaxExpansion);
     TESTCASE_AUTO(TestDisplayName);
     TESTCASE_AUTO(TestAttribute);
@@ -2490,6 +2644,7 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestNULLCharTailoring);
     TESTCASE_AUTO(TestClone);
     TESTCASE_AUTO(TestCloneBinary);
+    TESTCASE_AUTO(TestRulesCache);
     TESTCASE_AUTO(TestIterNumeric);
     TESTCASE_AUTO(TestBadKeywords);
     TESTCASE_AUTO_END;
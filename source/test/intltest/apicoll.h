@@ -168,8 +168,11 @@ public:
 
     void TestClone();
     void TestCloneBinary();
+    void TestRulesCache();
     void TestIterNumeric();
     void TestBadKeywords();
+    void TestTruncatedSortKey();
+    void TestPrefixKeys();
 
 private:
     // If this is too small for the test data, just increase it.
@@ -69,6 +69,7 @@ public:
     void TestImplicits();
     void TestNulTerminated();
     void TestIllegalUTF8();
+    void TestFastScripts();
     void TestShortFCDData();
     void TestFCD();
     void TestCollationWeights();
@@ -139,6 +140,7 @@ void CollationTest::runIndexedTest(int32_t index, UBool exec, const char *&name,
     TESTCASE_AUTO(TestImplicits);
     TESTCASE_AUTO(TestNulTerminated);
     TESTCASE_AUTO(TestIllegalUTF8);
+    TESTCASE_AUTO(TestFastScripts);
     TESTCASE_AUTO(TestShortFCDData);
     TESTCASE_AUTO(TestFCD);
     TESTCASE_AUTO(TestCollationWeights);
@@ -315,6 +317,92 @@ void CollationTest::TestIllegalUTF8() {
     }
 }
 
+void CollationTest::TestFastScripts() {
+    // Compare strings in scripts with fast script tables, mixed with ASCII and
+    // with some characters that must bail out, and check that
+    // compare() and compareUTF8() agree with the sort key order.
+    IcuTestErrorCode errorCode(*this, "TestFastScripts");
+    static const char *const locales[] = { "root", "ru", "uk", "sr", "el", "ar", "fa" };
+    static const UChar32 chars[] = {
+        // ASCII
+        0x20, 0x2d, 0x2e, 0x31, 0x32, 0x41, 0x62,
+        // Greek
+        0x3b1, 0x3ac, 0x3b2, 0x391, 0x3c3, 0x3c2, 0x3c9, 0x3ce, 0x390, 0x3dd, 0x3e3, 0x301,
+        // Cyrillic
+        0x430, 0x410, 0x431, 0x435, 0x451, 0x401, 0x438, 0x439, 0x456, 0x457, 0x491,
+        0x44f, 0x42f, 0x4d9, 0x306, 0x308,
+        // Arabic
+        0x627, 0x623, 0x628, 0x67e, 0x62a, 0x645, 0x64a, 0x6cc, 0x643, 0x6a9,
+        0x661, 0x6f1, 0x60c, 0x64e, 0x654,
+        // punctuation & others
+        0x2010, 0x2019, 0xe9, 0x4e00
+    };
+    static const UColAttributeValue strengths[] = {
+        UCOL_PRIMARY, UCOL_SECONDARY, UCOL_TERTIARY, UCOL_QUATERNARY
+    };
+    uint32_t seed = 1;
+    for(int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        LocalPointer<Collator> lcoll(Collator::createInstance(locales[i], errorCode));
+        if(errorCode.logDataIfFailureAndReset("Collator::createInstance(%s)", locales[i])) {
+            continue;
+        }
+        for(int32_t settings = 0; settings < 8; ++settings) {
+            lcoll->setAttribute(UCOL_STRENGTH, strengths[settings & 3], errorCode);
+            lcoll->setAttribute(UCOL_ALTERNATE_HANDLING,
+                                (settings & 4) != 0 ? UCOL_SHIFTED : UCOL_NON_IGNORABLE, errorCode);
+            lcoll->setAttribute(UCOL_CASE_FIRST,
+                                (settings & 1) != 0 ? UCOL_UPPER_FIRST : UCOL_OFF, errorCode);
+            if(settings == 5) {
+                int32_t codes[] = { UCOL_REORDER_CODE_DIGIT, USCRIPT_CYRILLIC, USCRIPT_GREEK };
+                lcoll->setReorderCodes(codes, UPRV_LENGTHOF(codes), errorCode);
+            } else if(settings == 6) {
+                int32_t codes[] = { USCRIPT_ARABIC, USCRIPT_CYRILLIC, USCRIPT_GREEK };
+                lcoll->setReorderCodes(codes, UPRV_LENGTHOF(codes), errorCode);
+            } else {
+                lcoll->setReorderCodes(NULL, 0, errorCode);
+            }
+            if(errorCode.logIfFailureAndReset("setting attributes")) { return; }
+            for(int32_t j = 0; j < 200; ++j) {
+                UnicodeString s[2];
+                for(int32_t k = 0; k < 2; ++k) {
+                    if(k == 1 && (j & 1) != 0) {
+                        // Share a prefix.
+                        s[1].setTo(s[0], 0, s[0].length() / 2);
+                    }
+                    int32_t length = (int32_t)((seed >> 16) % 6) + 1;
+                    for(int32_t n = 0; n < length; ++n) {
+                        seed = seed * 1103515245 + 12345;
+                        s[k].append(chars[(seed >> 16) % UPRV_LENGTHOF(chars)]);
+                    }
+                }
+                CollationKey key0, key1;
+                lcoll->getCollationKey(s[0], key0, errorCode);
+                lcoll->getCollationKey(s[1], key1, errorCode);
+                UCollationResult expected = key0.compareTo(key1, errorCode);
+                UCollationResult order = lcoll->compare(s[0], s[1], errorCode);
+                if(errorCode.logIfFailureAndReset("compare()")) { return; }
+                if(order != expected) {
+                    errln(UnicodeString(locales[i]) + " settings " + settings +
+                          ": compare(" + prettify(s[0]) + ", " + prettify(s[1]) + ")=" +
+                          order + " != " + expected + " from sort keys");
+                }
+#if U_HAVE_STD_STRING
+                std::string utf8[2];
+                s[0].toUTF8String(utf8[0]);
+                s[1].toUTF8String(utf8[1]);
+                order = lcoll->compareUTF8(utf8[0], utf8[1], errorCode);
+                if(errorCode.logIfFailureAndReset("compareUTF8()")) { return; }
+                if(order != expected) {
+                    errln(UnicodeString(locales[i]) + " settings " + settings +
+                          ": compareUTF8(" + prettify(s[0]) + ", " + prettify(s[1]) + ")=" +
+                          order + " != " + expected + " from sort keys");
+                }
+#endif
+            }
+        }
+    }
+}
+
 namespace {
 
 void addLeadSurrogatesForSupplementary(const UnicodeSet &src, UnicodeSet &dest) {
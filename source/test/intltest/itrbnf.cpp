@@ -70,6 +70,7 @@ void IntlTestRBNF::runIndexedTest(int32_t index, UBool exec, const char* &name,
         TESTCASE(21, TestMultiplePluralRules);
         TESTCASE(22, TestInfinityNaN);
         TESTCASE(23, TestVariableDecimalPoint);
+        TESTCASE(24, TestSmallValueRuleLookup);
 #else
         TESTCASE(0, TestRBNFDisabled);
 #endif
@@ -2217,6 +2218,60 @@ void IntlTestRBNF::TestVariableDecimalPoint() {
     doTest(&enFormatter, enTestCommaData, true);
 }
 
+void IntlTestRBNF::TestSmallValueRuleLookup() {
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseError;
+    // Rule lookups for small values come from a table built when the
+    // rules are parsed; make sure they agree with the rules around the
+    // edges of that table.
+    UnicodeString rules(
+            "-x: minus >>;"
+            "0: zero;"
+            "1: one;"
+            "2: two;"
+            "10: ten[ >>];"
+            "20: twenty[->>];"
+            "90: ninety[->>];"
+            "100: << hundred[ >>];"
+            "1000: << thousand[ >>];");
+    RuleBasedNumberFormat formatter(rules, Locale::getEnglish(), parseError, status);
+    if (U_FAILURE(status)) {
+        dataerrln("Unable to create RuleBasedNumberFormat - " + UnicodeString(u_errorName(status)));
+        return;
+    }
+    const char * const testData[][2] = {
+            {"0", "zero"},
+            {"1", "one"},
+            {"9", "two"},
+            {"10", "ten"},
+            {"19", "ten two"},
+            {"21", "twenty-one"},
+            {"89", "twenty-two"},
+            {"90", "ninety"},
+            {"99", "ninety-two"},
+            {"100", "one hundred"},
+            {"101", "one hundred one"},
+            {"-5", "minus two"},
+            { NULL, NULL }
+    };
+    doTest(&formatter, testData, false);
+
+    // Integer and double inputs take different paths to the rule set.
+    RuleBasedNumberFormat spellout(URBNF_SPELLOUT, Locale::getEnglish(), status);
+    if (U_FAILURE(status)) {
+        dataerrln("Unable to create RuleBasedNumberFormat - " + UnicodeString(u_errorName(status)));
+        return;
+    }
+    for (int32_t n = -150; n <= 150; ++n) {
+        UnicodeString fromInt, fromDouble;
+        spellout.format(n, fromInt);
+        spellout.format((double)n, fromDouble);
+        if (fromInt != fromDouble) {
+            errln(UnicodeString("FAIL: spellout of ") + n + " gave " + fromInt + " and " + fromDouble);
+        }
+    }
+}
+
 void 
 IntlTestRBNF::doTest(RuleBasedNumberFormat* formatter, const char* const testData[][2], UBool testParsing) 
 {
@@ -142,6 +142,7 @@ class IntlTestRBNF : public IntlTest {
 
     void TestInfinityNaN();
     void TestVariableDecimalPoint();
+    void TestSmallValueRuleLookup();
     void TestRounding();
 
 protected:
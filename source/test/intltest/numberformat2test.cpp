@@ -2056,6 +2056,33 @@ void NumberFormat2Test::TestDoubleInitVisibleDigitsToDigitList() {
                 TRUE,
                 precision.initVisibleDigits(-45.8251, digits, status));
         assertSuccess("45.83", status);
+        assertEquals("45.83 abs double", 45.83, digits.getAbsDoubleValue());
+    }
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        FixedPrecision precision;
+        precision.fSignificant.setMax(2);
+        precision.fRoundingMode = DecimalFormat::kRoundHalfUp;
+        // Like a DigitList, round from 1.25000000000000E15 rather than
+        // from all the digits of the double.
+        verifyVisibleDigits(
+                "1300000000000000",
+                FALSE,
+                precision.initVisibleDigits(1249999999999999.0, digits, status));
+        assertSuccess("1300000000000000", status);
+        assertEquals("1300000000000000 abs double", 1.3e15, digits.getAbsDoubleValue());
+    }
+    {
+        UErrorCode status = U_ZERO_ERROR;
+        FixedPrecision precision;
+        precision.fSignificant.setMax(2);
+        precision.fRoundingMode = DecimalFormat::kRoundHalfUp;
+        verifyVisibleDigits(
+                "120000000000000",
+                TRUE,
+                precision.initVisibleDigits(-124999999999999.0, digits, status));
+        assertSuccess("120000000000000", status);
+        assertEquals("120000000000000 abs double", 1.2e14, digits.getAbsDoubleValue());
     }
 }
 
@@ -18,8 +18,10 @@
 #include "unicode/localpointer.h"
 #include "unicode/ucurr.h"
 #include "unicode/ustring.h"
+#include "shareddecimalformat.h"
 #include "unicode/measfmt.h"
 #include "unicode/curramt.h"
+#include "unicode/currpinf.h"
 #include "digitlst.h"
 #include "textfile.h"
 #include "tokiter.h"
@@ -578,6 +580,12 @@ void NumberFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &n
   TESTCASE_AUTO(Test11475_signRecognition);
   TESTCASE_AUTO(Test11640_getAffixes);
   TESTCASE_AUTO(Test11649_toPatternWithMultiCurrency);
+  TESTCASE_AUTO(TestDoubleDigitList);
+  TESTCASE_AUTO(TestFormatToBuffer);
+  TESTCASE_AUTO(TestFormatArray);
+  TESTCASE_AUTO(TestFastParse);
+  TESTCASE_AUTO(TestSharedDecimalFormat);
+  TESTCASE_AUTO(TestFixedPointRounding);
   TESTCASE_AUTO_END;
 }
 
@@ -8714,6 +8722,252 @@ void NumberFormatTest::Test11649_toPatternWithMultiCurrency() {
     assertEquals("", "US dollars 12.34", fmt2.format(12.34, appendTo));
 }
 
+// Linear congruential generator for reproducible pseudo-random test input.
+static uint64_t nextRandom(uint64_t &state) {
+    state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+    return state;
+}
+
+void NumberFormatTest::TestDoubleDigitList() {
+    // DigitList::set(double) must yield the double rounded to DBL_DIG significant digits,
+    // trimmed like with the former sprintf() conversion.
+    // getDouble() must convert those digits back like strtod().
+    static const double values[] = {
+        0.1, 0.2, 0.3, 0.1 + 0.2, 1.0 / 3.0, 2.0 / 3.0, 1.0, 10.0, 100.0, 123.456,
+        1e21, 1e22, 1e23, 9007199254740993.0, 5e-324, 2.2250738585072014e-308,
+        1.7976931348623157e308, 4.35, 0.000123, 1234567.891, 99999999999999.99,
+        123456789012345678.0, 1e-7, 0.5, 1.5, 2.5
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    uint64_t seed = 0x12345678;
+    for (int32_t i = 0; i < 20000; ++i) {
+        double d;
+        if (i < UPRV_LENGTHOF(values)) {
+            d = values[i];
+        } else {
+            uint64_t random = nextRandom(seed);
+            if ((i & 2) != 0) {
+                // Random short decimals.
+                static const double scales[] = { 1, 10, 100, 1e3, 1e5, 1e8 };
+                d = (double)(int64_t)((random >> 24) % 10000000000LL) / scales[(random >> 8) % 6];
+            } else {
+                // Random bit patterns, skipping NaN and infinity.
+                uint64_t bits = random;
+                if (((bits >> 52) & 0x7ff) == 0x7ff) {
+                    continue;
+                }
+                uprv_memcpy(&d, &bits, sizeof(d));
+            }
+        }
+        if ((i & 1) != 0) {
+            d = -d;
+        }
+        char rep[64];
+        sprintf(rep, "%+1.*e", DBL_DIG - 1, d);
+        char *comma = strchr(rep, ',');
+        if (comma != NULL) {
+            *comma = '.';
+        }
+        DigitList expected;
+        expected.set(StringPiece(rep), status);
+        expected.trim();
+        DigitList actual;
+        actual.set(d);
+        CharString expectedString, actualString;
+        expected.getDecimal(expectedString, status);
+        actual.getDecimal(actualString, status);
+        if (!assertSuccess("DigitList", status)) {
+            return;
+        }
+        if (uprv_strcmp(expectedString.data(), actualString.data()) != 0) {
+            errln("DigitList::set(%.17g) = %s expected %s",
+                  d, actualString.data(), expectedString.data());
+            continue;
+        }
+        // Convert the digits back via a DigitList without the cached double.
+        DigitList parsed;
+        parsed.set(actualString.toStringPiece(), status);
+        double roundTrip = parsed.getDouble();
+        double strtodResult = strtod(actualString.data(), NULL);
+        if (roundTrip != strtodResult) {
+            errln("DigitList::getDouble(%s) = %.17g expected %.17g",
+                  actualString.data(), roundTrip, strtodResult);
+        }
+    }
+}
+
+void NumberFormatTest::TestFormatToBuffer() {
+    static const char *const locales[] = { "en", "de", "fr", "ar", "ja", "en@numbers=arab" };
+    static const UNumberFormatStyle styles[] = {
+        UNUM_DECIMAL, UNUM_CURRENCY, UNUM_PERCENT, UNUM_SCIENTIFIC, UNUM_CURRENCY_ISO
+    };
+    static const double values[] = {
+        0.0, 1.0, -1.0, 0.5, -1234.5678, 0.1 + 0.2, 123456789.123, 1e-5, 1e20, -9.87e15
+    };
+    // The zero-allocation guarantee is checked in cintltst TestFormatNoHeap,
+    // which can install its own heap functions while ICU is not in use.
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        for (int32_t j = 0; j < UPRV_LENGTHOF(styles); ++j) {
+            UErrorCode status = U_ZERO_ERROR;
+            LocalPointer<NumberFormat> nf(
+                    NumberFormat::createInstance(locales[i], styles[j], status));
+            if (!assertSuccess(locales[i], status, TRUE) || nf.isNull()) {
+                return;
+            }
+            DecimalFormat *df = dynamic_cast<DecimalFormat *>(nf.getAlias());
+            if (df == NULL) {
+                errln("%s/%d: not a DecimalFormat", locales[i], (int)styles[j]);
+                continue;
+            }
+            for (int32_t k = 0; k < UPRV_LENGTHOF(values) * 2; ++k) {
+                double d = values[k / 2];
+                int64_t n = (int64_t)(d * 1000);
+                UnicodeString expected;
+                FieldPosition pos(FieldPosition::DONT_CARE);
+                if ((k & 1) == 0) {
+                    df->format(d, expected, pos);
+                } else {
+                    df->format(n, expected, pos);
+                }
+                char expected8[200];
+                int32_t expected8Length = 0;
+                u_strToUTF8(expected8, UPRV_LENGTHOF(expected8), &expected8Length,
+                            expected.getBuffer(), expected.length(), &status);
+
+                UChar buffer[100];
+                char buffer8[200];
+                int32_t length, length8;
+                if ((k & 1) == 0) {
+                    length = df->format(d, buffer, UPRV_LENGTHOF(buffer), status);
+                    length8 = df->formatUTF8(d, buffer8, UPRV_LENGTHOF(buffer8), status);
+                } else {
+                    length = df->format(n, buffer, UPRV_LENGTHOF(buffer), status);
+                    length8 = df->formatUTF8(n, buffer8, UPRV_LENGTHOF(buffer8), status);
+                }
+                if (!assertSuccess("format to buffer", status)) {
+                    return;
+                }
+                assertEquals("UTF-16 result", expected, UnicodeString(buffer, length));
+                assertEquals("UTF-8 result", expected8, buffer8);
+                assertEquals("UTF-8 length", expected8Length, length8);
+
+                // Preflighting
+                if ((k & 1) == 0) {
+                    int32_t preflightLength = df->format(d, NULL, 0, status);
+                    if (status != U_BUFFER_OVERFLOW_ERROR) {
+                        errln("preflighting UTF-16 - %s", u_errorName(status));
+                    }
+                    assertEquals("UTF-16 preflight length", expected.length(), preflightLength);
+                    status = U_ZERO_ERROR;
+                    int32_t preflightLength8 = df->formatUTF8(d, NULL, 0, status);
+                    if (status != U_BUFFER_OVERFLOW_ERROR) {
+                        errln("preflighting UTF-8 - %s", u_errorName(status));
+                    }
+                    assertEquals("UTF-8 preflight length", expected8Length, preflightLength8);
+                    status = U_ZERO_ERROR;
+                }
+            }
+        }
+    }
+}
+
+void NumberFormatTest::TestFormatArray() {
+    static const char *const locales[] = { "en", "de", "hi", "ar", "en@numbers=arab" };
+    static const UNumberFormatStyle styles[] = {
+        UNUM_DECIMAL, UNUM_CURRENCY, UNUM_PERCENT, UNUM_SCIENTIFIC, UNUM_CURRENCY_PLURAL
+    };
+    static const char *const patterns[] = {
+        NULL, "#,##,##0", "0000", "#,##0.###;(#,##0)", "##0", "#,##0.00", "* #,##0"
+    };
+    static const int64_t int64s[] = {
+        0, 1, -1, 999, 1000, -1000, 4095, 4096, 12345, 1234567, -1234567,
+        INT32_MAX, INT32_MIN, (int64_t)INT32_MAX + 1, INT64_C(123456789012345678),
+        INT64_MAX, INT64_MIN
+    };
+    static const double doubles[] = {
+        0.0, -0.0, 1.0, -1.0, 0.5, 1234.5, 1234567.0, -1234567.0, 999999999999999.0,
+        1e15, 1e20, 0.1 + 0.2, -9.87e-5, uprv_getNaN(), uprv_getInfinity(), -uprv_getInfinity()
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        for (int32_t j = 0; j < UPRV_LENGTHOF(styles) + UPRV_LENGTHOF(patterns); ++j) {
+            UErrorCode status = U_ZERO_ERROR;
+            LocalPointer<NumberFormat> nf(NumberFormat::createInstance(
+                    locales[i], j < UPRV_LENGTHOF(styles) ? styles[j] : UNUM_DECIMAL, status));
+            if (!assertSuccess(locales[i], status, TRUE) || nf.isNull()) {
+                return;
+            }
+            DecimalFormat *df = dynamic_cast<DecimalFormat *>(nf.getAlias());
+            if (df == NULL) {
+                errln("%s/%d: not a DecimalFormat", locales[i], (int)j);
+                continue;
+            }
+            if (j >= UPRV_LENGTHOF(styles) && patterns[j - UPRV_LENGTHOF(styles)] != NULL) {
+                df->applyPattern(patterns[j - UPRV_LENGTHOF(styles)], status);
+            }
+            if (j == UPRV_LENGTHOF(styles)) {
+                df->setMinimumGroupingDigits(2);
+            }
+
+            UnicodeString prefix("x");
+            UnicodeString result(prefix);
+            int32_t offsets[UPRV_LENGTHOF(int64s) + 1];
+            df->format(int64s, UPRV_LENGTHOF(int64s), result, offsets, status);
+            if (!assertSuccess("format(int64_t array)", status)) {
+                return;
+            }
+            UnicodeString expected(prefix);
+            for (int32_t k = 0; k < UPRV_LENGTHOF(int64s); ++k) {
+                assertEquals("int64 offset", expected.length(), offsets[k]);
+                UnicodeString single;
+                df->format(int64s[k], single);
+                assertEquals(UnicodeString("int64 ") + k,
+                        single, result.tempSubStringBetween(offsets[k], offsets[k + 1]));
+                expected.append(single);
+            }
+            assertEquals("int64 array", expected, result);
+            UnicodeString int64Results(result, prefix.length());
+
+            result = prefix;
+            int32_t doubleOffsets[UPRV_LENGTHOF(doubles) + 1];
+            df->format(doubles, UPRV_LENGTHOF(doubles), result, doubleOffsets, status);
+            if (!assertSuccess("format(double array)", status)) {
+                return;
+            }
+            expected = prefix;
+            for (int32_t k = 0; k < UPRV_LENGTHOF(doubles); ++k) {
+                UnicodeString single;
+                df->format(doubles[k], single);
+                assertEquals(UnicodeString("double ") + k,
+                        single, result.tempSubStringBetween(doubleOffsets[k], doubleOffsets[k + 1]));
+                expected.append(single);
+            }
+            assertEquals("double array", expected, result);
+            assertEquals("double array end offset", result.length(),
+                         doubleOffsets[UPRV_LENGTHOF(doubles)]);
+
+            // The C API, with preflighting.
+            const UNumberFormat *unf = reinterpret_cast<const UNumberFormat *>(df);
+            int32_t length = unum_formatDoubleArray(
+                    unf, doubles, UPRV_LENGTHOF(doubles), NULL, 0, NULL, &status);
+            assertEquals("unum_formatDoubleArray() preflighting",
+                         U_BUFFER_OVERFLOW_ERROR, status);
+            assertEquals("unum_formatDoubleArray() length",
+                         result.length() - prefix.length(), length);
+            status = U_ZERO_ERROR;
+            UChar buffer[1000];
+            length = unum_formatInt64Array(
+                    unf, int64s, UPRV_LENGTHOF(int64s),
+                    buffer, UPRV_LENGTHOF(buffer), offsets, &status);
+            if (assertSuccess("unum_formatInt64Array()", status)) {
+                assertEquals("unum_formatInt64Array() result",
+                             int64Results, UnicodeString(buffer, length));
+                assertEquals("unum_formatInt64Array() first offset", 0, offsets[0]);
+                assertEquals("unum_formatInt64Array() last offset",
+                             length, offsets[UPRV_LENGTHOF(int64s)]);
+            }
+        }
+    }
+}
 
 void NumberFormatTest::verifyFieldPositionIterator(
         NumberFormatTest_Attributes *expected, FieldPositionIterator &iter) {
@@ -8735,5 +8989,258 @@ void NumberFormatTest::verifyFieldPositionIterator(
 }
 
 
+void NumberFormatTest::TestFastParse() {
+    // Short plain numerals take the fast parse path, which must give the same
+    // results as the full parser. Padding the text to 32 or more characters
+    // with trailing junk forces the full parser for the same numeral.
+    static const char *const inputs[] = {
+        "0", "-0", "00", "0.0", "-0.00", "7", "-7", "123", "00123", "-123.450",
+        "0.0001", "1.", ".5", "-", "--1", "1-", "12345678901234567", "123456789012345678",
+        "1234567890123456789", "-999999999999999999", "99999999999999999999",
+        "9007199254740993", "0.1", "-2147483648", "2147483648", "-9223372036854775808",
+        "1e5", "1,234", "1.2.3", "1.000", "0.30000000000000004"
+    };
+    static const char *const localeIDs[] = { "en", "de", "fr" };
+    const UnicodeString padding(32, (UChar32)0x78, 32);
+    uint64_t seed = 0x12345678;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(localeIDs); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<DecimalFormat> fmt((DecimalFormat *)NumberFormat::createInstance(localeIDs[i], status));
+        if (!assertSuccess("", status, TRUE, __FILE__, __LINE__)) {
+            return;
+        }
+        UnicodeString decimal = fmt->getDecimalFormatSymbols()->getSymbol(DecimalFormatSymbols::kDecimalSeparatorSymbol);
+        for (int32_t j = 0; j < 2000; ++j) {
+            UnicodeString text;
+            if (j < UPRV_LENGTHOF(inputs)) {
+                text = UnicodeString(inputs[j], -1, US_INV);
+            } else {
+                // Random numerals of up to 20 digits with a locale decimal separator.
+                uint64_t random = nextRandom(seed);
+                int32_t length = 1 + (int32_t)((random >> 33) % 20);
+                int32_t decimalPos = (int32_t)((random >> 40) % (length + 2));
+                if ((random & 0x100) != 0) {
+                    text.append((UChar)0x2D);
+                }
+                uint64_t bits = random;
+                for (int32_t k = 0; k < length; ++k) {
+                    if (k == decimalPos) {
+                        text.append(decimal);
+                    }
+                    text.append((UChar)(0x30 + (bits % 10)));
+                    bits = (bits / 10) ^ (random >> 17);
+                }
+            }
+            for (int32_t intOnly = 0; intOnly < 2; ++intOnly) {
+                fmt->setParseIntegerOnly(intOnly != 0);
+                Formattable fastResult, slowResult;
+                ParsePosition fastPos(0), slowPos(0);
+                fmt->parse(text, fastResult, fastPos);
+                fmt->parse(text + padding, slowResult, slowPos);
+                if (fastPos.getIndex() != slowPos.getIndex() ||
+                        (fastPos.getIndex() == 0 && fastPos.getErrorIndex() != slowPos.getErrorIndex())) {
+                    errln(UnicodeString("Parse position mismatch for \"") + text + "\" in " + localeIDs[i] +
+                          ": " + fastPos.getIndex() + "/" + fastPos.getErrorIndex() +
+                          " vs. " + slowPos.getIndex() + "/" + slowPos.getErrorIndex());
+                    continue;
+                }
+                if (fastPos.getIndex() == 0) {
+                    continue;
+                }
+                status = U_ZERO_ERROR;
+                StringPiece fastDecimal = fastResult.getDecimalNumber(status);
+                StringPiece slowDecimal = slowResult.getDecimalNumber(status);
+                if (!assertSuccess("getDecimalNumber", status, FALSE, __FILE__, __LINE__)) {
+                    return;
+                }
+                if (fastResult != slowResult || fastDecimal != slowDecimal) {
+                    errln(UnicodeString("Parse result mismatch for \"") + text + "\" in " + localeIDs[i] +
+                          ": " + UnicodeString(fastDecimal.data(), fastDecimal.length(), US_INV) +
+                          " vs. " + UnicodeString(slowDecimal.data(), slowDecimal.length(), US_INV));
+                }
+            }
+        }
+    }
+}
+
+void NumberFormatTest::TestSharedDecimalFormat() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<DecimalFormat> fmt((DecimalFormat *)NumberFormat::createInstance("en", status));
+    if (!assertSuccess("", status, TRUE, __FILE__, __LINE__)) {
+        return;
+    }
+    const SharedDecimalFormat *shared = DecimalFormat::createSharedInstance(*fmt, status);
+    if (!assertSuccess("createSharedInstance", status)) {
+        return;
+    }
+    assertTrue("shared copy equals the configuration", **shared == *fmt);
+    assertTrue("shared copy is not the configuration", shared->get() != fmt.getAlias());
+
+    // An equal configuration gets the same shared instance.
+    LocalPointer<DecimalFormat> other((DecimalFormat *)fmt->clone());
+    const SharedDecimalFormat *shared2 = DecimalFormat::createSharedInstance(*other, status);
+    assertSuccess("createSharedInstance again", status);
+    assertTrue("equal configurations share an instance", shared == shared2);
+
+    // A different configuration gets its own, and the shared copy
+    // does not see changes to the configuration it was made from.
+    other->setMaximumFractionDigits(1);
+    const SharedDecimalFormat *shared3 = DecimalFormat::createSharedInstance(*other, status);
+    assertSuccess("createSharedInstance for another configuration", status);
+    assertTrue("different configurations do not share", shared != shared3);
+    UnicodeString result;
+    assertEquals("shared copy format", "1.235", (*shared)->format(1.23456, result));
+    result.remove();
+    assertEquals("other shared copy format", "1.2", (*shared3)->format(1.23456, result));
+
+    // Settings that only affect parsing are part of the configuration, too.
+#if UCONFIG_HAVE_PARSEALLINPUT
+    LocalPointer<DecimalFormat> parseAll((DecimalFormat *)fmt->clone());
+    parseAll->setAttribute(UNUM_PARSE_ALL_INPUT, UNUM_YES, status);
+    const SharedDecimalFormat *shared4 = DecimalFormat::createSharedInstance(*parseAll, status);
+    assertSuccess("createSharedInstance with UNUM_PARSE_ALL_INPUT", status);
+    assertTrue("UNUM_PARSE_ALL_INPUT makes another configuration", shared != shared4);
+    SharedObject::clearPtr(shared4);
+#endif
+    LocalPointer<DecimalFormat> plural((DecimalFormat *)fmt->clone());
+    plural->adoptCurrencyPluralInfo(new CurrencyPluralInfo("fr", status));
+    const SharedDecimalFormat *shared5 = DecimalFormat::createSharedInstance(*plural, status);
+    assertSuccess("createSharedInstance with CurrencyPluralInfo", status);
+    assertTrue("CurrencyPluralInfo makes another configuration", shared != shared5);
+    assertTrue("shared copy has the CurrencyPluralInfo",
+               *(*shared5)->getCurrencyPluralInfo() == *plural->getCurrencyPluralInfo());
+
+    SharedObject::clearPtr(shared);
+    SharedObject::clearPtr(shared2);
+    SharedObject::clearPtr(shared3);
+    SharedObject::clearPtr(shared5);
+}
+
+// If d has at most three fraction digits and they make an integer of
+// 16 digits below 2^53, sets exact to d and returns TRUE. Formatting a
+// double prints such a value exactly when its digits fit the pattern,
+// while a DigitList set from the double only keeps DBL_DIG digits.
+static UBool getSixteenDigitValue(double d, DigitList &exact, UErrorCode &status) {
+    double scaled = d;
+    for (int32_t n = 0; n <= 3; ++n, scaled = d * uprv_pow10(n)) {
+        if (uprv_fabs(scaled) > 9007199254740991.0) {
+            return FALSE;
+        }
+        if (scaled == uprv_floor(scaled)) {
+            if (uprv_fabs(scaled) < 1e15) {
+                return FALSE;
+            }
+            char text[40];
+            sprintf(text, "%.0fE-%d", scaled, (int)n);
+            exact.set(StringPiece(text), status);
+            return U_SUCCESS(status);
+        }
+    }
+    return FALSE;
+}
+
+void NumberFormatTest::TestFixedPointRounding() {
+    // Doubles and int64s that need rounding are rounded in int64 arithmetic.
+    // The results must match formatting the same value from a DigitList.
+    static const char *const patterns[] = {
+        "#,##0.00", "0", "#,##0.###", "0.0####", "@@", "@@@", "@##", "#,##0.00 \\u00a4", "0.00E0", "##0.##E0"
+    };
+    static const DecimalFormat::ERoundingMode modes[] = {
+        DecimalFormat::kRoundCeiling, DecimalFormat::kRoundFloor, DecimalFormat::kRoundDown,
+        DecimalFormat::kRoundUp, DecimalFormat::kRoundHalfEven, DecimalFormat::kRoundHalfDown,
+        DecimalFormat::kRoundHalfUp, DecimalFormat::kRoundUnnecessary
+    };
+    static const double values[] = {
+        0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.135, 1.005, -0.0049, 0.0051, 999.995, 9.9999,
+        123456.789, -1234567.891, 1e17, 1.23456789012345e20, 3.0e-7, 0.3, 2.675, 1.0 / 3.0,
+        // Between 1e15 and 2^53 a double holds more digits than a DigitList keeps.
+        999999999999999.5, 1e15, 1000000000000001.0, 1249999999999999.0, -1249999999999999.0,
+        4503599627370497.0, 9007199254740991.0, 9007199254740992.0,
+        // Integers that round differently from all their digits than from DBL_DIG of them.
+        1150000000000001.0, 3454999999999999.0, -3454999999999999.0, 8999999999999999.0
+    };
+    static const int64_t int64Values[] = {
+        0, 5, -5, 15, 25, 995, 123456, -987654321, 1234567890123LL, 999999999999999999LL,
+        -999999999999999999LL, 1000000000000000000LL, INT64_C(9223372036854775807)
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    DecimalFormatSymbols symbols(Locale::getEnglish(), status);
+    if (!assertSuccess("", status, TRUE, __FILE__, __LINE__)) {
+        return;
+    }
+    uint64_t seed = 0x12345678;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        status = U_ZERO_ERROR;
+        DecimalFormat fmt(UnicodeString(patterns[i], -1, US_INV).unescape(), symbols, status);
+        if (!assertSuccess(patterns[i], status)) {
+            continue;
+        }
+        for (int32_t j = 0; j < UPRV_LENGTHOF(modes); ++j) {
+            fmt.setRoundingMode(modes[j]);
+            for (int32_t k = 0; k < 400; ++k) {
+                double d;
+                if (k < UPRV_LENGTHOF(values)) {
+                    d = values[k];
+                } else {
+                    uint64_t random = nextRandom(seed);
+                    if ((random & 0x30) == 0) {
+                        // Random integers from 1e15 up to 2^53.
+                        d = (double)(int64_t)(UINT64_C(1000000000000000) +
+                            (random >> 11) % UINT64_C(8007199254740992));
+                    } else {
+                        // Random values with up to 15 digits at various scales.
+                        static const double scales[] = { 1e-8, 1e-4, 1e-2, 1, 1e3, 1e6 };
+                        d = (double)(int64_t)((random >> 16) % UINT64_C(1000000000000000)) /
+                            1e9 * scales[(random >> 8) % 6];
+                    }
+                    if ((random & 1) != 0) {
+                        d = -d;
+                    }
+                }
+                UnicodeString fast, slow;
+                UErrorCode fastStatus = U_ZERO_ERROR, slowStatus = U_ZERO_ERROR;
+                FieldPosition pos(FieldPosition::DONT_CARE);
+                fmt.format(d, fast, pos, fastStatus);
+                DigitList dl;
+                dl.set(d);
+                fmt.format(dl, slow, pos, slowStatus);
+                DigitList exact;
+                UErrorCode exactStatus = U_ZERO_ERROR;
+                if (!fmt.isScientificNotation() && getSixteenDigitValue(d, exact, exactStatus)) {
+                    // Without an exponent, digits that fit the pattern are kept,
+                    // and kRoundUnnecessary sees all of them.
+                    DecimalFormat exactFmt(fmt);
+                    exactFmt.setRoundingMode(DecimalFormat::kRoundUnnecessary);
+                    UnicodeString exactResult;
+                    exactFmt.format(exact, exactResult, pos, exactStatus);
+                    if (U_SUCCESS(exactStatus) || modes[j] == DecimalFormat::kRoundUnnecessary) {
+                        slow = exactResult;
+                        slowStatus = exactStatus;
+                    }
+                }
+                if (fastStatus != slowStatus || (U_SUCCESS(fastStatus) && fast != slow)) {
+                    errln(UnicodeString("double ") + d + " pattern " + patterns[i] + " mode " + modes[j] +
+                          ": " + fast + " " + u_errorName(fastStatus) +
+                          " vs. DigitList " + slow + " " + u_errorName(slowStatus));
+                }
+            }
+            for (int32_t k = 0; k < UPRV_LENGTHOF(int64Values); ++k) {
+                UnicodeString fast, slow;
+                UErrorCode fastStatus = U_ZERO_ERROR, slowStatus = U_ZERO_ERROR;
+                FieldPosition pos(FieldPosition::DONT_CARE);
+                fmt.format(int64Values[k], fast, pos, fastStatus);
+                DigitList dl;
+                dl.set(int64Values[k]);
+                fmt.format(dl, slow, pos, slowStatus);
+                if (fastStatus != slowStatus || (U_SUCCESS(fastStatus) && fast != slow)) {
+                    errln(UnicodeString("int64 ") + int64Values[k] + " pattern " + patterns[i] +
+                          " mode " + modes[j] + ": " + fast + " " + u_errorName(fastStatus) +
+                          " vs. DigitList " + slow + " " + u_errorName(slowStatus));
+                }
+            }
+        }
+    }
+}
+
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
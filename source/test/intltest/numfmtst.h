@@ -213,6 +213,12 @@ class NumberFormatTest: public CalendarTimeZoneTest {
     void Test11475_signRecognition();
     void Test11640_getAffixes();
     void Test11649_toPatternWithMultiCurrency();
+    void TestDoubleDigitList();
+    void TestFormatToBuffer();
+    void TestFormatArray();
+    void TestFastParse();
+    void TestSharedDecimalFormat();
+    void TestFixedPointRounding();
 
  private:
     UBool testFormattableAsUFormattable(const char *file, int line, Formattable &f);
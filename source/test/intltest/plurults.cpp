@@ -49,6 +49,7 @@ void PluralRulesTest::runIndexedTest( int32_t index, UBool exec, const char* &na
     TESTCASE_AUTO(testAvailbleLocales);
     TESTCASE_AUTO(testParseErrors);
     TESTCASE_AUTO(testFixedDecimal);
+    TESTCASE_AUTO(testIntegerTable);
     TESTCASE_AUTO_END;
 }
 
@@ -1000,5 +1001,44 @@ void PluralRulesTest::testFixedDecimal() {
 }
 
 
+// Integers below RuleChain::kIntegerTableSize are selected from a table built
+// when the rules are parsed. Check the table against a full evaluation of the
+// rules, which is forced by clearing hasIntegerValue (the rules never look at it.)
+void PluralRulesTest::testIntegerTable() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<StringEnumeration> localesEnum(PluralRules::getAvailableLocales(status));
+    if (U_FAILURE(status)) {
+        dataerrln("file %s, line %d: Error status = %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    const char *locale;
+    while ((locale = localesEnum->next(NULL, status)) != NULL && U_SUCCESS(status)) {
+        for (int32_t type = UPLURAL_TYPE_CARDINAL; type < UPLURAL_TYPE_COUNT; ++type) {
+            LocalPointer<PluralRules> rules(PluralRules::forLocale(
+                    Locale(locale), (UPluralType) type, status));
+            if (U_FAILURE(status)) {
+                errln("file %s, line %d: Error status = %s for locale %s",
+                      __FILE__, __LINE__, u_errorName(status), locale);
+                return;
+            }
+            LocalPointer<PluralRules> clone(rules->clone());
+            for (int32_t n = 0; n < RuleChain::kIntegerTableSize; ++n) {
+                FixedDecimal evaluated(n, 0, 0);
+                evaluated.hasIntegerValue = FALSE;
+                UnicodeString expected = rules->select(evaluated);
+                UnicodeString actual = rules->select(n);
+                UnicodeString actualClone = clone->select(FixedDecimal(n, 0, 0));
+                if (expected != actual || expected != actualClone) {
+                    errln(UnicodeString("locale ") + locale + ", type " + type +
+                          ", n = " + n + ": expected " + expected + ", got " +
+                          actual + " and " + actualClone + " from the clone");
+                    break;
+                }
+            }
+        }
+    }
+}
+
+
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -35,6 +35,7 @@ private:
     void testAvailbleLocales();
     void testParseErrors();
     void testFixedDecimal();
+    void testIntegerTable();
 
     void assertRuleValue(const UnicodeString& rule, double expected);
     void assertRuleKeyValue(const UnicodeString& rule, const UnicodeString& key,
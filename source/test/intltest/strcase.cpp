@@ -22,6 +22,7 @@
 #include "unicode/locid.h"
 #include "unicode/ubrk.h"
 #include "unicode/unistr.h"
+#include "unicode/ustring.h"
 #include "unicode/ucasemap.h"
 #include "ucase.h"
 #include "ustrtest.h"
@@ -41,6 +42,7 @@ StringCaseTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestCasing);
 #endif
     TESTCASE_AUTO(TestFullCaseFoldingIterator);
+    TESTCASE_AUTO(TestCaseFoldedHashCode);
     TESTCASE_AUTO_END;
 }
 
@@ -571,3 +573,48 @@ StringCaseTest::TestFullCaseFoldingIterator() {
         errln("error: FullCaseFoldingIterator yielded only %d (cp, full) pairs", (int)count);
     }
 }
+
+void
+StringCaseTest::TestCaseFoldedHashCode() {
+    static const uint32_t options[]={ U_FOLD_CASE_DEFAULT, U_FOLD_CASE_EXCLUDE_SPECIAL_I };
+    for(int32_t i=0; i<UPRV_LENGTHOF(options); ++i) {
+        // Every BMP code point and its folding: caseCompare() and the
+        // case-folded hash code must agree with the folded copy.
+        for(UChar32 c=0; c<=0xffff; ++c) {
+            UnicodeString s=UnicodeString((UChar)0x58).append(c).append((UChar)0x79);
+            UnicodeString folded(s);
+            folded.foldCase(options[i]);
+            if(s.caseCompare(folded, options[i])!=0) {
+                errln("error: caseCompare(\"X\\u%04lX\"+y, folded, 0x%lx)!=0", (long)c, (long)options[i]);
+            }
+            if(s.caseFoldedHashCode(options[i])!=folded.caseFoldedHashCode(options[i])) {
+                errln("error: caseFoldedHashCode(\"X\\u%04lX\"+y, 0x%lx) differs from that of its folding",
+                      (long)c, (long)options[i]);
+            }
+            // Compare with the next code point: same sign as comparing the folded strings.
+            UnicodeString t=UnicodeString((UChar)0x78).append(c+1).append((UChar)0x59);
+            UnicodeString tFolded(t);
+            tFolded.foldCase(options[i]);
+            int8_t expected=folded.compare(tFolded);
+            int8_t actual=s.caseCompare(t, options[i]);
+            if(actual!=expected) {
+                errln("error: caseCompare(\"X\\u%04lX\"+y, next, 0x%lx)=%d but folded compare=%d",
+                      (long)c, (long)options[i], actual, expected);
+            }
+        }
+    }
+
+    UnicodeString mixed=UNICODE_STRING_SIMPLE("Stra\\u00dfe \\uFB03 \\U00010400").unescape();
+    UnicodeString other=UNICODE_STRING_SIMPLE("STRASSE ffi \\U00010428").unescape();
+    if(mixed.caseCompare(other, U_FOLD_CASE_DEFAULT)!=0 ||
+            mixed.caseFoldedHashCode()!=other.caseFoldedHashCode()) {
+        errln("error: caseCompare()/caseFoldedHashCode() mismatch for strings with multi-code point foldings");
+    }
+    if(mixed.caseFoldedHashCode()!=
+            u_strFoldCaseHash(other.getTerminatedBuffer(), -1, U_FOLD_CASE_DEFAULT)) {
+        errln("error: u_strFoldCaseHash(NUL-terminated) differs from caseFoldedHashCode()");
+    }
+    if(UnicodeString().caseFoldedHashCode()!=UnicodeString().hashCode()) {
+        errln("error: caseFoldedHashCode() of the empty string differs from its hashCode()");
+    }
+}
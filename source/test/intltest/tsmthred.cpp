@@ -48,6 +48,9 @@ MultithreadTest::~MultithreadTest()
 
 // for mthreadtest
 #include "unicode/numfmt.h"
+#include "unicode/decimfmt.h"
+#include "unicode/compactdecimalformat.h"
+#include "shareddecimalformat.h"
 #include "unicode/choicfmt.h"
 #include "unicode/msgfmt.h"
 #include "unicode/locid.h"
@@ -132,6 +135,22 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
         }
         break;
 #endif
+    case 10:
+        name = "TestSharedDecimalFormat";
+#if !UCONFIG_NO_FORMATTING
+        if (exec) {
+            TestSharedDecimalFormat();
+        }
+#endif
+        break;
+    case 11:
+        name = "TestCompactDecimalFormat";
+#if !UCONFIG_NO_FORMATTING
+        if (exec) {
+            TestCompactDecimalFormat();
+        }
+#endif
+        break;
     default:
         name = "";
         break; //needed to end loop
@@ -1570,3 +1589,139 @@ void MultithreadTest::TestBreakTranslit() {
 }
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+#if !UCONFIG_NO_FORMATTING
+//
+//  Shared DecimalFormat Threading Test
+//     Threads get the cached, shared copy of one DecimalFormat configuration
+//     and format with it concurrently, without cloning.
+//
+
+static const DecimalFormat *gSharedDecimalFormatConfig;
+static const SharedDecimalFormat *gSharedDecimalFormat;
+static const double gSharedDecimalFormatNumbers[] = { 0.0, -1.5, 1234.5678, 1e12, 3.14159, -0.001 };
+static const UnicodeString *gSharedDecimalFormatExpected;
+
+class SharedDecimalFormatThread: public SimpleThread {
+  public:
+    SharedDecimalFormatThread() {};
+    ~SharedDecimalFormatThread() {};
+    void run();
+};
+
+void SharedDecimalFormatThread::run() {
+    for (int i=0; i<100; i++) {
+        UErrorCode status = U_ZERO_ERROR;
+        const SharedDecimalFormat *shared =
+                DecimalFormat::createSharedInstance(*gSharedDecimalFormatConfig, status);
+        if (U_FAILURE(status) || shared != gSharedDecimalFormat) {
+            IntlTest::gTest->errln("%s:%d Expected the same shared DecimalFormat - %s",
+                                   __FILE__, __LINE__, u_errorName(status));
+            SharedObject::clearPtr(shared);
+            break;
+        }
+        for (int j=0; j<UPRV_LENGTHOF(gSharedDecimalFormatNumbers); j++) {
+            UnicodeString result;
+            (*shared)->format(gSharedDecimalFormatNumbers[j], result);
+            if (gSharedDecimalFormatExpected[j] != result) {
+                IntlTest::gTest->errln("%s:%d Shared DecimalFormat threading failure.", __FILE__, __LINE__);
+                break;
+            }
+        }
+        shared->removeRef();
+    }
+}
+
+void MultithreadTest::TestSharedDecimalFormat() {
+    UErrorCode status = U_ZERO_ERROR;
+    DecimalFormat config(UNICODE_STRING_SIMPLE("#,##0.00#;(#)"),
+                         new DecimalFormatSymbols(Locale::getGerman(), status), status);
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Error creating DecimalFormat - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    gSharedDecimalFormatConfig = &config;
+    gSharedDecimalFormat = DecimalFormat::createSharedInstance(config, status);
+    TSMTHREAD_ASSERT_SUCCESS(status);
+
+    UnicodeString expected[UPRV_LENGTHOF(gSharedDecimalFormatNumbers)];
+    for (int i=0; i<UPRV_LENGTHOF(gSharedDecimalFormatNumbers); ++i) {
+        config.format(gSharedDecimalFormatNumbers[i], expected[i]);
+    }
+    gSharedDecimalFormatExpected = expected;
+
+    SharedDecimalFormatThread threads[4];
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].start();
+    }
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].join();
+    }
+
+    SharedObject::clearPtr(gSharedDecimalFormat);
+    gSharedDecimalFormatConfig = NULL;
+    gSharedDecimalFormatExpected = NULL;
+}
+
+//
+//  CompactDecimalFormat Threading Test
+//     Threads format numbers of every magnitude with one shared
+//     CompactDecimalFormat concurrently, without cloning.
+//
+
+static const CompactDecimalFormat *gCompactDecimalFormat;
+static const double gCompactDecimalFormatNumbers[] = {
+    0.0, 1.0, 2.0, 5.0, 21.0, -1234.0, 1000.0, 2000.0, 5000.0, 21000.0, 999999.0,
+    1.5e6, -2.2e7, 5e8, 1.23456e9, 4e10, 3.5e11, 1e12, 2.5e13, 8.76e14, 1e15 };
+static const UnicodeString *gCompactDecimalFormatExpected;
+
+class CompactDecimalFormatThread: public SimpleThread {
+  public:
+    CompactDecimalFormatThread() {};
+    ~CompactDecimalFormatThread() {};
+    void run();
+};
+
+void CompactDecimalFormatThread::run() {
+    for (int i=0; i<100; i++) {
+        for (int j=0; j<UPRV_LENGTHOF(gCompactDecimalFormatNumbers); j++) {
+            UnicodeString result;
+            gCompactDecimalFormat->format(gCompactDecimalFormatNumbers[j], result);
+            if (gCompactDecimalFormatExpected[j] != result) {
+                IntlTest::gTest->errln("%s:%d CompactDecimalFormat threading failure.", __FILE__, __LINE__);
+                return;
+            }
+        }
+    }
+}
+
+void MultithreadTest::TestCompactDecimalFormat() {
+    UErrorCode status = U_ZERO_ERROR;
+    // Russian has several plural categories in its compact affixes.
+    LocalPointer<CompactDecimalFormat> cdf(CompactDecimalFormat::createInstance(
+            Locale("ru"), UNUM_LONG, status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Error creating CompactDecimalFormat - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    gCompactDecimalFormat = cdf.getAlias();
+
+    UnicodeString expected[UPRV_LENGTHOF(gCompactDecimalFormatNumbers)];
+    for (int i=0; i<UPRV_LENGTHOF(gCompactDecimalFormatNumbers); ++i) {
+        cdf->format(gCompactDecimalFormatNumbers[i], expected[i]);
+    }
+    gCompactDecimalFormatExpected = expected;
+
+    CompactDecimalFormatThread threads[4];
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].start();
+    }
+    for (int i=0; i<UPRV_LENGTHOF(threads); ++i) {
+        threads[i].join();
+    }
+
+    gCompactDecimalFormat = NULL;
+    gCompactDecimalFormatExpected = NULL;
+}
+
+#endif /* !UCONFIG_NO_FORMATTING */
@@ -50,6 +50,8 @@ public:
     void TestConditionVariables();
     void TestUnifiedCache();
     void TestBreakTranslit();
+    void TestSharedDecimalFormat();
+    void TestCompactDecimalFormat();
 
 };
 
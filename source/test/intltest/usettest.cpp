@@ -91,6 +91,9 @@ UnicodeSetTest::runIndexedTest(int32_t index, UBool exec,
         CASE(22,TestSpan);
         CASE(23,TestStringSpan);
         CASE(24,TestUCAUnsafeBackwards);
+        CASE(25,TestSpanASCIIBlocks);
+        CASE(26,TestSerializeFrozen);
+        CASE(27,TestSpanManyStrings);
         default: name = ""; break;
     }
 }
@@ -3922,3 +3925,190 @@ void UnicodeSetTest::TestUCAUnsafeBackwards() {
     }
 #endif
 }
+
+// Long ASCII runs are spanned many code units at a time for frozen sets
+// with few ASCII ranges. Compare with a code point loop over contains().
+void UnicodeSetTest::TestSpanASCIIBlocks() {
+    static const char *const patterns[]={
+        "[a-z]", "[A-Za-z0-9_]", "[\\u0000-\\u007f]", "[^a]", "[:L:]", "[]",
+        "[\\u0080-\\uffff]", "[\\u0000-\\u007f\\u00e4]",
+        "[a-z0-9!#%'+]"  // more than four ASCII ranges
+    };
+    UnicodeString text=UNICODE_STRING_SIMPLE(
+        "the_quick_brown_fox_jumps_over_the_lazy_dog_0123456789_"
+        "THE QUICK BROWN FOX\\u00e4\\u4e00\\U0001F600abcdefghijklmnopqrstuvwxyzABC!#%'+").unescape();
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UnicodeSet set(UnicodeString(patterns[i], -1, US_INV).unescape(), errorCode);
+        if(U_FAILURE(errorCode)) {
+            dataerrln("FAIL: Unable to create UnicodeSet(%s) - %s", patterns[i], u_errorName(errorCode));
+            continue;
+        }
+        set.freeze();
+        for(int32_t start=0; start<text.length(); start+=3) {
+            const UChar *s=text.getBuffer()+start;
+            int32_t length=text.length()-start;
+            char s8[400];
+            int32_t length8;
+            u_strToUTF8(s8, (int32_t)sizeof(s8), &length8, s, length, &errorCode);
+            for(int32_t cond=0; cond<=1; ++cond) {
+                USetSpanCondition spanCondition=(USetSpanCondition)cond;
+                // Reference span.
+                int32_t expected=0;
+                while(expected<length) {
+                    UChar32 c;
+                    int32_t next=expected;
+                    U16_NEXT(s, next, length, c);
+                    if(set.contains(c)!=(UBool)cond) {
+                        break;
+                    }
+                    expected=next;
+                }
+                int32_t expected8;
+                u_strToUTF8(NULL, 0, &expected8, s, expected, &errorCode);
+                errorCode=U_ZERO_ERROR;
+                if(set.span(s, length, spanCondition)!=expected) {
+                    errln("FAIL: UnicodeSet(%s).span(text+%d, %d)=%d!=%d",
+                          patterns[i], start, cond, set.span(s, length, spanCondition), expected);
+                }
+                if(set.spanUTF8(s8, length8, spanCondition)!=expected8) {
+                    errln("FAIL: UnicodeSet(%s).spanUTF8(text+%d, %d)=%d!=%d",
+                          patterns[i], start, cond, set.spanUTF8(s8, length8, spanCondition), expected8);
+                }
+            }
+        }
+    }
+}
+
+// A frozen set loaded from serializeFrozen() output must behave like the original.
+void UnicodeSetTest::TestSerializeFrozen() {
+    static const char *const patterns[]={
+        "[[:L:]&[:Script=Han:]]", "[a-z\\u00e4\\U0001F600]", "[]", "[^a]",
+        "[a-z{ab}{xyz}]",  // strings relevant for span()
+        "[a-z{ab}{cd}]"    // strings irrelevant for span()
+    };
+    UnicodeString text=UNICODE_STRING_SIMPLE(
+        "abxyz\\u00e4\\u4e00\\u4e8c\\U00020000xyzab\\U0001F600_cd\\u4e00").unescape();
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UnicodeSet set(UnicodeString(patterns[i], -1, US_INV).unescape(), errorCode);
+        if(U_FAILURE(errorCode)) {
+            dataerrln("FAIL: Unable to create UnicodeSet(%s) - %s", patterns[i], u_errorName(errorCode));
+            continue;
+        }
+        int32_t capacity=set.serializeFrozen(NULL, 0, errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || capacity<=0) {
+            errln("FAIL: UnicodeSet(%s).serializeFrozen() preflighting - %s", patterns[i], u_errorName(errorCode));
+            continue;
+        }
+        errorCode=U_ZERO_ERROR;
+        LocalArray<uint32_t> buffer(new uint32_t[capacity/4]);
+        set.freeze();
+        int32_t length=set.serializeFrozen(buffer.getAlias(), capacity, errorCode);
+        if(U_FAILURE(errorCode) || length!=capacity) {
+            errln("FAIL: UnicodeSet(%s).serializeFrozen()=%d!=%d - %s",
+                  patterns[i], length, capacity, u_errorName(errorCode));
+            continue;
+        }
+        LocalPointer<UnicodeSet> loaded(
+            UnicodeSet::createFrozenFromSerialized(buffer.getAlias(), length, errorCode));
+        if(U_FAILURE(errorCode)) {
+            errln("FAIL: UnicodeSet(%s) createFrozenFromSerialized() - %s", patterns[i], u_errorName(errorCode));
+            continue;
+        }
+        if(!loaded->isFrozen() || *loaded!=set) {
+            errln("FAIL: UnicodeSet(%s) createFrozenFromSerialized() not frozen or not equal", patterns[i]);
+        }
+        LocalPointer<UnicodeSet> thawed((UnicodeSet *)loaded->cloneAsThawed());
+        if(thawed->isFrozen() || *thawed!=set) {
+            errln("FAIL: UnicodeSet(%s) cloneAsThawed() of the loaded set", patterns[i]);
+        }
+        for(UChar32 c=0; c<=0x20000; c+=0x1f) {
+            if(loaded->contains(c)!=set.contains(c)) {
+                errln("FAIL: UnicodeSet(%s) loaded.contains(U+%04lx) differs", patterns[i], (long)c);
+                break;
+            }
+        }
+        char s8[100];
+        int32_t length8;
+        u_strToUTF8(s8, (int32_t)sizeof(s8), &length8, text.getBuffer(), text.length(), &errorCode);
+        for(int32_t start=0; start<text.length(); ++start) {
+            const UChar *s=text.getBuffer()+start;
+            int32_t sLength=text.length()-start;
+            for(int32_t cond=0; cond<=2; ++cond) {
+                USetSpanCondition spanCondition=(USetSpanCondition)cond;
+                if( loaded->span(s, sLength, spanCondition)!=set.span(s, sLength, spanCondition) ||
+                    loaded->spanBack(s, sLength, spanCondition)!=set.spanBack(s, sLength, spanCondition) ||
+                    loaded->spanUTF8(s8, length8, spanCondition)!=set.spanUTF8(s8, length8, spanCondition)
+                ) {
+                    errln("FAIL: UnicodeSet(%s) loaded span(text+%d, %d) differs", patterns[i], start, cond);
+                }
+            }
+        }
+        // Corrupt data must be rejected.
+        buffer[3]^=0xff;  // dataFormat
+        errorCode=U_ZERO_ERROR;
+        LocalPointer<UnicodeSet> bad(
+            UnicodeSet::createFrozenFromSerialized(buffer.getAlias(), length, errorCode));
+        if(U_SUCCESS(errorCode) || bad.isValid()) {
+            errln("FAIL: UnicodeSet(%s) createFrozenFromSerialized(corrupt data) did not fail", patterns[i]);
+        }
+    }
+}
+
+// Frozen sets with many strings match them via tries.
+// Compare with the string-by-string matching of an unfrozen copy.
+void UnicodeSetTest::TestSpanManyStrings() {
+    static const char *const patterns[]={
+        "[a-c{ab}{abc}{bca}{cab}{cd}{dc}{dcb}{ddd}{xy}{xyz}{yzx}{zz}{\\U0001F600\\U0001F601}{x\\U0001F600}"
+            "{\\u00e4a}{a\\u00e4}{\\u00e4\\u00e4\\u00e4}{bb}{cc}]",
+        "[{ab}{ba}{abab}{bab}{aab}{abb}{bba}{baa}{aaa}{bbb}{\\ud800a}{a\\udc00}{\\U00010000a}]",
+        "[\\U0001F600-\\U0001F602{\\U0001F600x}{x\\U0001F601}{xx}{xyx}{yxy}{yy}{xyz}{zyx}{zz}]"
+    };
+    // Text alphabet including unpaired surrogates:
+    // U+D800 before a BMP character, and U+DC00 after a supplementary one.
+    UnicodeString alphabet=UNICODE_STRING_SIMPLE("abcdxyz\\ud800\\u00e4\\U0001F600\\U0001F601\\U00010000").unescape();
+    alphabet.append((UChar)0xdc00);
+    int32_t alphabetSize=alphabet.countChar32();
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UnicodeSet thawed(UnicodeString(patterns[i], -1, US_INV).unescape(), errorCode);
+        if(U_FAILURE(errorCode)) {
+            errln("FAIL: Unable to create UnicodeSet(%s) - %s", patterns[i], u_errorName(errorCode));
+            continue;
+        }
+        UnicodeSet frozen(thawed);
+        frozen.freeze();
+        uint32_t seed=12345;
+        for(int32_t t=0; t<300; ++t) {
+            UnicodeString text;
+            int32_t textLength=(t%24)+1;
+            for(int32_t j=0; j<textLength; ++j) {
+                seed=seed*1103515245+12345;
+                text.append(alphabet.char32At(alphabet.moveIndex32(0, (int32_t)((seed>>16)%alphabetSize))));
+            }
+            // UTF-8 cannot hold unpaired surrogates; substitute U+FFFD.
+            char s8[200];
+            int32_t length8;
+            u_strToUTF8WithSub(s8, (int32_t)sizeof(s8), &length8, text.getBuffer(), text.length(),
+                               0xfffd, NULL, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                errln("FAIL: u_strToUTF8WithSub() - %s", u_errorName(errorCode));
+                return;
+            }
+            const UChar *s=text.getBuffer();
+            int32_t length=text.length();
+            for(int32_t cond=0; cond<=2; ++cond) {
+                USetSpanCondition spanCondition=(USetSpanCondition)cond;
+                if( frozen.span(s, length, spanCondition)!=thawed.span(s, length, spanCondition) ||
+                    frozen.spanBack(s, length, spanCondition)!=thawed.spanBack(s, length, spanCondition) ||
+                    frozen.spanUTF8(s8, length8, spanCondition)!=thawed.spanUTF8(s8, length8, spanCondition) ||
+                    frozen.spanBackUTF8(s8, length8, spanCondition)!=thawed.spanBackUTF8(s8, length8, spanCondition)
+                ) {
+                    errln("FAIL: UnicodeSet(%s) frozen vs. thawed span differs for text %d condition %d",
+                          patterns[i], t, cond);
+                }
+            }
+        }
+    }
+}
@@ -90,6 +90,12 @@ private:
 
     void TestUCAUnsafeBackwards();
 
+    void TestSpanASCIIBlocks();
+
+    void TestSerializeFrozen();
+
+    void TestSpanManyStrings();
+
 private:
 
     UBool toPatternAux(UChar32 start, UChar32 end);
@@ -0,0 +1,677 @@
+/*
+**********************************************************************
+*   Copyright (C) 2016, International Business Machines
+*   Corporation and others.  All Rights Reserved.
+**********************************************************************
+*   file name:  numfmtperf.cpp
+*   encoding:   US-ASCII
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Performance tests for number formatting and parsing:
+*   DecimalFormat, currency, CompactDecimalFormat,
+*   RuleBasedNumberFormat and MeasureFormat.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unicode/uperf.h"
+#include "unicode/compactdecimalformat.h"
+#include "unicode/curramt.h"
+#include "unicode/fieldpos.h"
+#include "unicode/fmtable.h"
+#include "unicode/measfmt.h"
+#include "unicode/measunit.h"
+#include "unicode/measure.h"
+#include "unicode/numfmt.h"
+#include "unicode/parsepos.h"
+#include "unicode/rbnf.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uclean.h"
+#include "unicode/unistr.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+#include "umutex.h"
+#include "uoptions.h"
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+// Command-line options specific to numfmtperf.
+// Options do not have abbreviations: Force readable command lines.
+// (Using U+0001 for abbreviation characters.)
+enum {
+    THREAD_COUNT,
+    COUNT_ALLOCATIONS,
+    NUMFMTPERF_OPTIONS_COUNT
+};
+
+static UOption options[NUMFMTPERF_OPTIONS_COUNT]={
+    UOPTION_DEF("threads", '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("allocs",  '\x01', UOPT_NO_ARG)
+};
+
+static const char *const numfmtperf_usage =
+    "\t--threads   Number of threads that run each operation concurrently,\n"
+    "\t            each with its own formatters.\n"
+    "\t            Default: 1\n"
+    "\t--allocs    Report the number of heap allocations per iteration\n"
+    "\t            as the events count.\n"
+    "\t-L          Comma-separated list of locales.\n"
+    "\t            Default: en_US,de_DE,fr_FR,ja_JP,ru_RU,ar_EG,hi_IN,pt_BR\n";
+
+static const char *const gDefaultLocales = "en_US,de_DE,fr_FR,ja_JP,ru_RU,ar_EG,hi_IN,pt_BR";
+
+// Number of input values of each type.
+static const int32_t kInputCount = 200;
+
+// Length of each decimal number string, including the decimal point.
+static const int32_t kDecimalStringLength = 26;
+
+// Heap allocation counting. With --allocs, main() installs these functions
+// before ICU is used; they forward to the C library.
+static u_atomic_int32_t gAllocationCount = ATOMIC_INT32_T_INITIALIZER(0);
+
+static void * U_CALLCONV countingAlloc(const void * /*context*/, size_t size) {
+    umtx_atomic_inc(&gAllocationCount);
+    return malloc(size);
+}
+
+static void * U_CALLCONV countingRealloc(const void * /*context*/, void *mem, size_t size) {
+    umtx_atomic_inc(&gAllocationCount);
+    return realloc(mem, size);
+}
+
+static void U_CALLCONV countingFree(const void * /*context*/, void *mem) {
+    free(mem);
+}
+
+// Test object with setup data.
+class NumberFormatPerformanceTest : public UPerfTest {
+public:
+    NumberFormatPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), numfmtperf_usage, status),
+              locales(NULL), localeCount(0), threadCount(1), countAllocations(FALSE) {
+        if (U_FAILURE(status)) {
+            return;
+        }
+        if (options[THREAD_COUNT].doesOccur) {
+            threadCount = atoi(options[THREAD_COUNT].value);
+            if (threadCount < 1) {
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+        }
+        countAllocations = options[COUNT_ALLOCATIONS].doesOccur;
+        initLocales(locale != NULL ? locale : gDefaultLocales, status);
+        initInputs();
+        if (verbose) {
+            printf("locales:%ld  inputs:%ld  threads:%ld\n",
+                   (long)localeCount, (long)kInputCount, (long)threadCount);
+        }
+    }
+
+    virtual ~NumberFormatPerformanceTest() {
+        delete[] locales;
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    Locale *locales;
+    int32_t localeCount;
+    int32_t threadCount;
+    UBool countAllocations;
+
+    int64_t ints[kInputCount];
+    double doubles[kInputCount];
+    char decimals[kInputCount][kDecimalStringLength + 1];
+
+private:
+    void initLocales(const char *list, UErrorCode &status) {
+        localeCount = 1;
+        for (const char *p = list; *p != 0; ++p) {
+            if (*p == ',') {
+                ++localeCount;
+            }
+        }
+        locales = new Locale[localeCount];
+        if (locales == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        const char *start = list;
+        for (int32_t i = 0; i < localeCount; ++i) {
+            const char *limit = strchr(start, ',');
+            if (limit == NULL) {
+                limit = start + strlen(start);
+            }
+            char id[ULOC_FULLNAME_CAPACITY];
+            int32_t length = (int32_t)(limit - start);
+            if (length >= ULOC_FULLNAME_CAPACITY) {
+                length = ULOC_FULLNAME_CAPACITY - 1;
+            }
+            memcpy(id, start, length);
+            id[length] = 0;
+            locales[i] = Locale(id);
+            start = *limit == 0 ? limit : limit + 1;
+        }
+    }
+
+    // Fills in values of all magnitudes from a fixed pseudo-random sequence
+    // so that runs are comparable.
+    void initInputs() {
+        uint64_t seed = 1;
+        for (int32_t i = 0; i < kInputCount; ++i) {
+            int64_t magnitude = 10;
+            for (int32_t j = i % 12; j > 0; --j) {
+                magnitude *= 10;
+            }
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            int64_t value = (int64_t)(seed >> 11) % magnitude;
+            if (i % 7 == 3) {
+                value = -value;
+            }
+            ints[i] = value;
+
+            // Zero to three fraction digits.
+            double divisor = 1.0;
+            for (int32_t j = i % 4; j > 0; --j) {
+                divisor *= 10.0;
+            }
+            doubles[i] = (double)value / divisor;
+
+            char *p = decimals[i];
+            if (i % 7 == 3) {
+                *p++ = '-';
+            }
+            int32_t pointIndex = 1 + i % (kDecimalStringLength - 3);
+            for (int32_t j = (int32_t)(p - decimals[i]); j < kDecimalStringLength; ++j) {
+                if (j == pointIndex) {
+                    *p++ = '.';
+                } else {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    *p++ = (char)('0' + (seed >> 33) % 10);
+                }
+            }
+            *p = 0;
+        }
+    }
+};
+
+class Command;
+
+// Runs one Command's work for one thread.
+class WorkerThread {
+public:
+    WorkerThread() : command(NULL), threadIndex(0), status(U_ZERO_ERROR) {}
+
+    UBool start(Command *c, int32_t index);
+    void join();
+
+    void run();
+
+    Command *command;
+    int32_t threadIndex;
+    UErrorCode status;
+
+private:
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    HANDLE handle;
+#else
+    pthread_t thread;
+#endif
+};
+
+// Performance test function object.
+// Each thread has its own formatter for each locale; one iteration
+// runs every input through every locale's formatter on every thread.
+class Command : public UPerfFunction {
+protected:
+    Command(const NumberFormatPerformanceTest &testcase)
+            : testcase(testcase), formats(NULL), formatCount(0), allocations(0) {}
+
+    // Creates the formatter that this command exercises.
+    virtual Format *createFormat(const Locale &locale, UErrorCode &status) = 0;
+
+    // Runs the operation on input i with the formatter for the locale.
+    virtual void run(const Format &format, int32_t localeIndex, int32_t i,
+                     UnicodeString &buffer, UErrorCode &status) = 0;
+
+    // Creates the formatters. Subclasses that need more setup,
+    // such as text to parse, override this and call it first.
+    virtual void init(UErrorCode &status) {
+        formatCount = testcase.threadCount * testcase.localeCount;
+        formats = new Format *[formatCount];
+        if (formats == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        uprv_memset(formats, 0, formatCount * sizeof(Format *));
+        for (int32_t i = 0; i < formatCount && U_SUCCESS(status); ++i) {
+            formats[i] = createFormat(testcase.locales[i % testcase.localeCount], status);
+            if (U_SUCCESS(status) && formats[i] == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+        }
+    }
+
+    // Returns the command, or NULL with an error message if it could
+    // not be set up.
+    static UPerfFunction *get(Command *command, const char *name) {
+        UErrorCode status = U_ZERO_ERROR;
+        if (command != NULL) {
+            command->init(status);
+        } else {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "error: unable to set up %s - %s\n", name, u_errorName(status));
+            delete command;
+            return NULL;
+        }
+        return command;
+    }
+
+public:
+    virtual ~Command() {
+        for (int32_t i = 0; i < formatCount; ++i) {
+            delete formats[i];
+        }
+        delete[] formats;
+    }
+
+    virtual void call(UErrorCode* pErrorCode) {
+        uint32_t start = (uint32_t)umtx_loadAcquire(gAllocationCount);
+        if (testcase.threadCount == 1) {
+            runThread(0, *pErrorCode);
+        } else {
+            WorkerThread *threads = new WorkerThread[testcase.threadCount];
+            if (threads == NULL) {
+                *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            int32_t started = 0;
+            while (started < testcase.threadCount && threads[started].start(this, started)) {
+                ++started;
+            }
+            if (started < testcase.threadCount) {
+                fprintf(stderr, "error: unable to start thread %ld\n", (long)started);
+                *pErrorCode = U_INTERNAL_PROGRAM_ERROR;
+            }
+            for (int32_t i = 0; i < started; ++i) {
+                threads[i].join();
+                if (U_FAILURE(threads[i].status) && U_SUCCESS(*pErrorCode)) {
+                    *pErrorCode = threads[i].status;
+                }
+            }
+            delete[] threads;
+        }
+        allocations = (uint32_t)umtx_loadAcquire(gAllocationCount) - start;
+    }
+
+    void runThread(int32_t threadIndex, UErrorCode &status) {
+        UnicodeString buffer;
+        Format **threadFormats = formats + threadIndex * testcase.localeCount;
+        for (int32_t localeIndex = 0; localeIndex < testcase.localeCount; ++localeIndex) {
+            const Format &format = *threadFormats[localeIndex];
+            for (int32_t i = 0; i < kInputCount && U_SUCCESS(status); ++i) {
+                buffer.remove();
+                run(format, localeIndex, i, buffer, status);
+            }
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        return (long)testcase.threadCount * testcase.localeCount * kInputCount;
+    }
+
+    virtual long getEventsPerIteration() {
+        return testcase.countAllocations ? (long)allocations : -1;
+    }
+
+protected:
+    const NumberFormatPerformanceTest &testcase;
+    Format **formats;
+    int32_t formatCount;
+    uint32_t allocations;
+};
+
+#if U_PLATFORM_USES_ONLY_WIN32_API
+static unsigned int __stdcall workerThreadMain(void *arg) {
+    ((WorkerThread *)arg)->run();
+    return 0;
+}
+#else
+extern "C" {
+static void *workerThreadMain(void *arg) {
+    ((WorkerThread *)arg)->run();
+    return NULL;
+}
+}
+#endif
+
+UBool WorkerThread::start(Command *c, int32_t index) {
+    command = c;
+    threadIndex = index;
+    status = U_ZERO_ERROR;
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    handle = (HANDLE)_beginthreadex(NULL, 0, workerThreadMain, this, 0, NULL);
+    return handle != 0;
+#else
+    return pthread_create(&thread, NULL, workerThreadMain, this) == 0;
+#endif
+}
+
+void WorkerThread::join() {
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+void WorkerThread::run() {
+    command->runThread(threadIndex, status);
+}
+
+// Formats with the locale's default NumberFormat for a style.
+class NumberFormatCommand : public Command {
+protected:
+    NumberFormatCommand(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style)
+            : Command(testcase), style(style) {}
+
+    virtual Format *createFormat(const Locale &locale, UErrorCode &status) {
+        return NumberFormat::createInstance(locale, style, status);
+    }
+
+    UNumberFormatStyle style;
+};
+
+class FormatInt : public NumberFormatCommand {
+protected:
+    FormatInt(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style)
+            : NumberFormatCommand(testcase, style) {}
+public:
+    static UPerfFunction* get(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style, const char *name) {
+        return Command::get(new FormatInt(testcase, style), name);
+    }
+    virtual void run(const Format &format, int32_t /*localeIndex*/, int32_t i,
+                     UnicodeString &buffer, UErrorCode & /*status*/) {
+        ((const NumberFormat &)format).format(testcase.ints[i], buffer);
+    }
+};
+
+class FormatDouble : public NumberFormatCommand {
+protected:
+    FormatDouble(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style)
+            : NumberFormatCommand(testcase, style) {}
+public:
+    static UPerfFunction* get(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style, const char *name) {
+        return Command::get(new FormatDouble(testcase, style), name);
+    }
+    virtual void run(const Format &format, int32_t /*localeIndex*/, int32_t i,
+                     UnicodeString &buffer, UErrorCode & /*status*/) {
+        ((const NumberFormat &)format).format(testcase.doubles[i], buffer);
+    }
+};
+
+class FormatDecimal : public NumberFormatCommand {
+protected:
+    FormatDecimal(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style)
+            : NumberFormatCommand(testcase, style) {}
+public:
+    static UPerfFunction* get(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style, const char *name) {
+        return Command::get(new FormatDecimal(testcase, style), name);
+    }
+    virtual void run(const Format &format, int32_t /*localeIndex*/, int32_t i,
+                     UnicodeString &buffer, UErrorCode &status) {
+        ((const NumberFormat &)format).format(StringPiece(testcase.decimals[i]), buffer, NULL, status);
+    }
+};
+
+// Parses text that the same formatter produced from the inputs.
+class Parse : public NumberFormatCommand {
+public:
+    enum InputType { INT, DOUBLE, DECIMAL };
+
+protected:
+    Parse(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style, InputType type)
+            : NumberFormatCommand(testcase, style), type(type), texts(NULL) {}
+
+    virtual void init(UErrorCode &status) {
+        Command::init(status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        texts = new UnicodeString[testcase.localeCount * kInputCount];
+        if (texts == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        for (int32_t localeIndex = 0; localeIndex < testcase.localeCount; ++localeIndex) {
+            const NumberFormat &format = (const NumberFormat &)*formats[localeIndex];
+            for (int32_t i = 0; i < kInputCount; ++i) {
+                UnicodeString &text = texts[localeIndex * kInputCount + i];
+                switch (type) {
+                case INT:
+                    format.format(testcase.ints[i], text);
+                    break;
+                case DOUBLE:
+                    format.format(testcase.doubles[i], text);
+                    break;
+                case DECIMAL:
+                    format.format(StringPiece(testcase.decimals[i]), text, NULL, status);
+                    break;
+                }
+            }
+        }
+    }
+
+public:
+    static UPerfFunction* get(const NumberFormatPerformanceTest &testcase, UNumberFormatStyle style,
+                              InputType type, const char *name) {
+        return Command::get(new Parse(testcase, style, type), name);
+    }
+
+    virtual ~Parse() {
+        delete[] texts;
+    }
+
+    virtual void run(const Format &format, int32_t localeIndex, int32_t i,
+                     UnicodeString & /*buffer*/, UErrorCode &status) {
+        const NumberFormat &nf = (const NumberFormat &)format;
+        const UnicodeString &text = texts[localeIndex * kInputCount + i];
+        if (style == UNUM_CURRENCY) {
+            ParsePosition pos;
+            CurrencyAmount *amount = nf.parseCurrency(text, pos);
+            if (amount == NULL) {
+                status = U_PARSE_ERROR;
+            }
+            delete amount;
+            return;
+        }
+        Formattable result;
+        nf.parse(text, result, status);
+        if (type == DECIMAL) {
+            result.getDecimalNumber(status);
+        }
+    }
+
+private:
+    InputType type;
+    UnicodeString *texts;
+};
+
+class CompactFormat : public Command {
+protected:
+    CompactFormat(const NumberFormatPerformanceTest &testcase, UNumberCompactStyle style, UBool useDoubles)
+            : Command(testcase), style(style), useDoubles(useDoubles) {}
+
+    virtual Format *createFormat(const Locale &locale, UErrorCode &status) {
+        return CompactDecimalFormat::createInstance(locale, style, status);
+    }
+
+public:
+    static UPerfFunction* get(const NumberFormatPerformanceTest &testcase, UNumberCompactStyle style,
+                              UBool useDoubles, const char *name) {
+        return Command::get(new CompactFormat(testcase, style, useDoubles), name);
+    }
+    virtual void run(const Format &format, int32_t /*localeIndex*/, int32_t i,
+                     UnicodeString &buffer, UErrorCode & /*status*/) {
+        const NumberFormat &nf = (const NumberFormat &)format;
+        if (useDoubles) {
+            nf.format(testcase.doubles[i], buffer);
+        } else {
+            nf.format(testcase.ints[i], buffer);
+        }
+    }
+
+private:
+    UNumberCompactStyle style;
+    UBool useDoubles;
+};
+
+class RuleBasedFormat : public Command {
+protected:
+    RuleBasedFormat(const NumberFormatPerformanceTest &testcase, URBNFRuleSetTag tag, UBool useDoubles)
+            : Command(testcase), tag(tag), useDoubles(useDoubles) {}
+
+    virtual Format *createFormat(const Locale &locale, UErrorCode &status) {
+        return new RuleBasedNumberFormat(tag, locale, status);
+    }
+
+public:
+    static UPerfFunction* get(const NumberFormatPerformanceTest &testcase, URBNFRuleSetTag tag,
+                              UBool useDoubles, const char *name) {
+        return Command::get(new RuleBasedFormat(testcase, tag, useDoubles), name);
+    }
+    virtual void run(const Format &format, int32_t /*localeIndex*/, int32_t i,
+                     UnicodeString &buffer, UErrorCode & /*status*/) {
+        const NumberFormat &nf = (const NumberFormat &)format;
+        if (useDoubles) {
+            nf.format(testcase.doubles[i], buffer);
+        } else {
+            nf.format(testcase.ints[i], buffer);
+        }
+    }
+
+private:
+    URBNFRuleSetTag tag;
+    UBool useDoubles;
+};
+
+// Formats the double inputs as lengths in meters.
+class MeasureFormatDouble : public Command {
+protected:
+    MeasureFormatDouble(const NumberFormatPerformanceTest &testcase, UMeasureFormatWidth width)
+            : Command(testcase), width(width), measures(NULL) {}
+
+    virtual Format *createFormat(const Locale &locale, UErrorCode &status) {
+        return new MeasureFormat(locale, width, status);
+    }
+
+    virtual void init(UErrorCode &status) {
+        Command::init(status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        measures = (Measure *)uprv_malloc(kInputCount * sizeof(Measure));
+        if (measures == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        for (int32_t i = 0; i < kInputCount; ++i) {
+            new(measures + i) Measure(testcase.doubles[i], MeasureUnit::createMeter(status), status);
+        }
+    }
+
+public:
+    static UPerfFunction* get(const NumberFormatPerformanceTest &testcase, UMeasureFormatWidth width, const char *name) {
+        return Command::get(new MeasureFormatDouble(testcase, width), name);
+    }
+
+    virtual ~MeasureFormatDouble() {
+        if (measures != NULL) {
+            for (int32_t i = 0; i < kInputCount; ++i) {
+                measures[i].~Measure();
+            }
+            uprv_free(measures);
+        }
+    }
+
+    virtual void run(const Format &format, int32_t /*localeIndex*/, int32_t i,
+                     UnicodeString &buffer, UErrorCode &status) {
+        FieldPosition pos(0);
+        ((const MeasureFormat &)format).formatMeasures(measures + i, 1, buffer, pos, status);
+    }
+
+private:
+    UMeasureFormatWidth width;
+    Measure *measures;
+};
+
+UPerfFunction* NumberFormatPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    switch (index) {
+        case 0: name = "DecimalFormatInt";      if (exec) return FormatInt::get(*this, UNUM_DECIMAL, name); break;
+        case 1: name = "DecimalFormatDouble";   if (exec) return FormatDouble::get(*this, UNUM_DECIMAL, name); break;
+        case 2: name = "DecimalFormatDecimal";  if (exec) return FormatDecimal::get(*this, UNUM_DECIMAL, name); break;
+        case 3: name = "DecimalParseInt";       if (exec) return Parse::get(*this, UNUM_DECIMAL, Parse::INT, name); break;
+        case 4: name = "DecimalParseDouble";    if (exec) return Parse::get(*this, UNUM_DECIMAL, Parse::DOUBLE, name); break;
+        case 5: name = "DecimalParseDecimal";   if (exec) return Parse::get(*this, UNUM_DECIMAL, Parse::DECIMAL, name); break;
+        case 6: name = "PercentFormatDouble";   if (exec) return FormatDouble::get(*this, UNUM_PERCENT, name); break;
+        case 7: name = "ScientificFormatDouble";if (exec) return FormatDouble::get(*this, UNUM_SCIENTIFIC, name); break;
+        case 8: name = "CurrencyFormatInt";     if (exec) return FormatInt::get(*this, UNUM_CURRENCY, name); break;
+        case 9: name = "CurrencyFormatDouble";  if (exec) return FormatDouble::get(*this, UNUM_CURRENCY, name); break;
+        case 10: name = "CurrencyFormatDecimal";if (exec) return FormatDecimal::get(*this, UNUM_CURRENCY, name); break;
+        case 11: name = "CurrencyParseDouble";  if (exec) return Parse::get(*this, UNUM_CURRENCY, Parse::DOUBLE, name); break;
+        case 12: name = "CompactShortInt";      if (exec) return CompactFormat::get(*this, UNUM_SHORT, FALSE, name); break;
+        case 13: name = "CompactShortDouble";   if (exec) return CompactFormat::get(*this, UNUM_SHORT, TRUE, name); break;
+        case 14: name = "CompactLongDouble";    if (exec) return CompactFormat::get(*this, UNUM_LONG, TRUE, name); break;
+        case 15: name = "SpelloutInt";          if (exec) return RuleBasedFormat::get(*this, URBNF_SPELLOUT, FALSE, name); break;
+        case 16: name = "SpelloutDouble";       if (exec) return RuleBasedFormat::get(*this, URBNF_SPELLOUT, TRUE, name); break;
+        case 17: name = "OrdinalInt";           if (exec) return RuleBasedFormat::get(*this, URBNF_ORDINAL, FALSE, name); break;
+        case 18: name = "MeasureWideDouble";    if (exec) return MeasureFormatDouble::get(*this, UMEASFMT_WIDTH_WIDE, name); break;
+        case 19: name = "MeasureShortDouble";   if (exec) return MeasureFormatDouble::get(*this, UMEASFMT_WIDTH_SHORT, name); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+
+    // Heap functions can only be set while ICU is not in use,
+    // so look for --allocs before the test object parses the options.
+    for (int32_t i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--allocs") == 0) {
+            u_setMemoryFunctions(NULL, countingAlloc, countingRealloc, countingFree, &status);
+            if (U_FAILURE(status)) {
+                printf("Unable to count allocations: %s\n", u_errorName(status));
+                return status;
+            }
+            break;
+        }
+    }
+
+    NumberFormatPerformanceTest test(argc, argv, status);
+
+	if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run, please check the "
+			            "arguments.\n");
+        return 1;
+    }
+
+    return 0;
+}
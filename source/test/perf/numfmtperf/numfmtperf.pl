@@ -0,0 +1,59 @@
+#!/usr/bin/perl
+#  ********************************************************************
+#  * COPYRIGHT:
+#  * Copyright (c) 2016, International Business Machines Corporation and
+#  * others. All Rights Reserved.
+#  ********************************************************************
+
+#use strict;
+
+require "../perldriver/Common.pl";
+
+use lib '../perldriver';
+
+use PerfFramework;
+
+my $options = {
+    "title"=>"Number formatting and parsing performance",
+    "headers"=>"1thread 4threads",
+    "operationIs"=>"formatted or parsed number",
+    "passes"=>"3",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "outputDir"=>"../results"
+};
+
+# programs
+# tests will be done for all the programs. Results will be stored and connected
+my $p;
+if ($OnWindows) {
+    $p = "cd ".$ICULatest."/bin && ".$ICUPathLatest."/numfmtperf/$WindowsPlatform/Release/numfmtperf.exe";
+} else {
+    $p = "LD_LIBRARY_PATH=".$ICULatest."/source/lib:".$ICULatest."/source/tools/ctestfw ".$ICUPathLatest."/numfmtperf/numfmtperf";
+}
+
+my @names = (
+    "DecimalFormatInt", "DecimalFormatDouble", "DecimalFormatDecimal",
+    "DecimalParseInt", "DecimalParseDouble", "DecimalParseDecimal",
+    "CurrencyFormatDouble", "CurrencyParseDouble",
+    "CompactShortDouble", "SpelloutInt", "SpelloutDouble", "MeasureWideDouble"
+);
+
+my $tests = {};
+foreach my $name (@names) {
+    $tests->{$name} = [
+        "$p,$name --threads 1",
+        "$p,$name --threads 4"
+    ];
+}
+
+# The locales are passed with -L; there are no data files.
+my $dataFiles = {
+    "en_US", [ "" ],
+    "de_DE", [ "" ],
+    "ja_JP", [ "" ],
+    "ru_RU", [ "" ],
+    "ar_EG", [ "" ]
+};
+
+runTests($options, $tests, $dataFiles);
@@ -13,9 +13,10 @@
 #include "collationtailoring.h"
 
 /**
- * Define the type of generator to use. Choose one.
+ * Define the type of generator to use. Choose one, or FROZEN together with SERIALIZE.
  */
-#define SERIALIZE 1   //< Default: use UnicodeSet.serialize() and a new internal c'tor
+#define FROZEN 1      //< Default: use UnicodeSet.serializeFrozen(); the list is used in place, no rebuilding
+#define SERIALIZE 1   //< Default: use UnicodeSet.serialize() and a new internal c'tor; fallback for FROZEN
 #define RANGES 0      //< Enumerate ranges (works, not as fast. No support in collationdatareader.cpp)
 #define PATTERN 0     //< Generate a UnicodeSet pattern (depends on #11891 AND probably slower. No support in collationdatareader.cpp)
 
@@ -35,6 +36,29 @@ int main(int argc, const char *argv[]) {
     fprintf(stderr, "Generating data for ICU %s, Collation %s\n", U_ICU_VERSION, verString);
     int32_t rangeCount = unsafeBackwardSet->getRangeCount();
     
+#if FROZEN
+    fprintf(stderr, ".. serializing frozen\n");
+    // Frozen UnicodeSet image, as 32-bit words for alignment.
+    // It is only usable on platforms with the same endianness and charset family;
+    // collationdatareader.cpp falls back to the SERIALIZE form on others.
+    int32_t frozenLength = unsafeBackwardSet->serializeFrozen(NULL, 0, errorCode);
+    if(errorCode == U_BUFFER_OVERFLOW_ERROR) {
+      errorCode = U_ZERO_ERROR;
+    }
+    if(U_FAILURE(errorCode) || (frozenLength & 3) != 0) {
+      fprintf(stderr, "Err: %s preflighting frozen unicode set\n", u_errorName(errorCode));
+      return 1;
+    }
+    int32_t frozenCount = frozenLength / 4;
+    uint32_t *frozenData = new uint32_t[frozenCount];
+    unsafeBackwardSet->serializeFrozen(frozenData, frozenLength, errorCode);
+    if(U_FAILURE(errorCode)) {
+      delete [] frozenData;
+      fprintf(stderr, "Err: %s serializing frozen unicodeset\n", u_errorName(errorCode));
+      return 1;
+    }
+#endif
+
 #if SERIALIZE
     fprintf(stderr, ".. serializing\n");
     // UnicodeSet serialization
@@ -141,6 +165,23 @@ int main(int argc, const char *argv[]) {
     printf("};\n");
 #endif
 
+#if FROZEN
+    printf("#define COLLUNSAFE_FROZEN 1\n");
+    printf("static const int32_t unsafe_frozenCount = %d;\n", frozenCount);
+    printf("static const uint32_t unsafe_frozenData[%d] = { \n", frozenCount);
+    for(int32_t i=0;i<frozenCount;i++) {
+      if( (i>0) && (i%6 == 0) ) {
+        printf(" // %d\n", i);
+      }
+      printf("0x%08X", frozenData[i]);
+      if(i != (frozenCount-1)) {
+        printf(", ");
+      }
+    }
+    printf("};\n");
+    delete [] frozenData;
+#endif
+
 #if SERIALIZE
     printf("#define COLLUNSAFE_SERIALIZE 1\n");    
     printf("static const int32_t unsafe_serializedCount = %d;\n", serializedCount);
@@ -43,6 +43,18 @@ int main(int argc, const char *argv[]) {
   }
 #endif
 
+#if defined (COLLUNSAFE_FROZEN)
+  {
+    puts("verify frozen");
+    UnicodeSet *u = UnicodeSet::createFrozenFromSerialized(unsafe_frozenData, unsafe_frozenCount * 4, errorCode);
+    fprintf(stderr, "\n%s:%d: err creating set %s\n", __FILE__, __LINE__, u_errorName(errorCode));
+    if(u != NULL) {
+      printf("Finished frozen set with %d ranges\n", u->getRangeCount());
+      delete u;
+    }
+  }
+#endif
+
 #if defined (COLLUNSAFE_SERIALIZE)
   {
     puts("verify serialize");